@@ -84,11 +84,6 @@ public:
 
 	bool phosphorEnabled() const { return myUsePhosphor; }
 
-	uInt8 getPhosphor(const uInt8 c1, uInt8 c2) const;
-
-	uInt16 getRGBPhosphor16(const uInt32 c, const uInt32 p) const;
-	uInt32 getRGBPhosphor32(const uInt32 c, const uInt32 p) const;
-
 	void clear() {}
 
 	void updateSurfaceSettings() {}
@@ -102,14 +97,11 @@ private:
 	PaletteHandler myPaletteHandler;
 	uInt16 tiaColorMap16[256]{};
 	uInt32 tiaColorMap32[256]{};
-	uInt8 myPhosphorPalette[256][256]{};
-	std::array<uInt8, 160 * TIAConstants::frameBufferHeight> prevFramebuffer{};
 	Common::Rect myImageRect{};
 	float myPhosphorPercent = 0.80f;
 	bool myUsePhosphor{};
 	IG::PixelFormat format;
 
-	std::array<uInt8, 3> getRGBPhosphorTriple(uInt32 c, uInt32 p) const;
 	template <int outputBits>
 	void renderOutput(IG::MutablePixmapView pix, TIA &tia);
 };
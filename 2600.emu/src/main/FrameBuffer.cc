@@ -19,6 +19,7 @@
 // TODO: Some Stella types collide with MacTypes.h
 #define Debugger DebuggerMac
 #include <emuframework/EmuApp.hh>
+#include <emuframework/EmuVideoLayer.hh>
 #undef Debugger
 #include <imagine/logger/logger.h>
 
@@ -41,21 +42,13 @@ void FrameBuffer::enablePhosphor(bool enable, int blend)
 		myPhosphorPercent = std::max(blend, 1) / 100.0;
   	logMsg("phosphor blend:%d (%.2f%%)", blend, myPhosphorPercent);
 	}
-	if(enable)
-  {
-    for(Int16 c = 255; c >= 0; c--)
-      for(Int16 p = 255; p >= 0; p--)
-        myPhosphorPalette[c][p] = getPhosphor(c, p);
-  }
-	prevFramebuffer = {};
-}
-
-uint8_t FrameBuffer::getPhosphor(uInt8 c1, uInt8 c2) const
-{
-	// Use maximum of current and decayed previous values
-	c2 = uInt8(c2 * myPhosphorPercent);
-	if(c1 > c2)  return c1; // raise (assumed immediate)
-	else         return c2; // decay
+	// blending is done on the GPU by the video layer, may be called from the content loader thread
+	appPtr->runOnMainThread(
+		[appPtr = appPtr, mode = enable ? EmuEx::FrameBlendMode::PHOSPHOR : EmuEx::FrameBlendMode::OFF,
+			persistence = myPhosphorPercent](IG::ApplicationContext)
+		{
+			appPtr->videoLayer().setSystemFrameBlend(mode, persistence);
+		});
 }
 
 void FrameBuffer::setTIAPalette(const PaletteArray& palette)
@@ -82,30 +75,6 @@ IG::PixelFormat FrameBuffer::pixelFormat() const
 	return format;
 }
 
-std::array<uInt8, 3> FrameBuffer::getRGBPhosphorTriple(uInt32 c, uInt32 p) const
-{
-	auto [rc, gc, bc, ac] = IG::PIXEL_DESC_RGBA8888_NATIVE.rgba(c);
-	auto [rp, gp, bp, ap] = IG::PIXEL_DESC_RGBA8888_NATIVE.rgba(p);
-
-  // Mix current calculated frame with previous displayed frame
-  const uInt8 rn = myPhosphorPalette[rc][rp];
-  const uInt8 gn = myPhosphorPalette[gc][gp];
-  const uInt8 bn = myPhosphorPalette[bc][bp];
-  return {rn, gn, bn};
-}
-
-uInt16 FrameBuffer::getRGBPhosphor16(const uInt32 c, const uInt32 p) const
-{
-  auto [rn, gn, bn] = getRGBPhosphorTriple(c, p);
-  return IG::PIXEL_DESC_RGB565.build(rn >> 3, gn >> 2, bn >> 3, 0);
-}
-
-uInt32 FrameBuffer::getRGBPhosphor32(const uInt32 c, const uInt32 p) const
-{
-  auto [rn, gn, bn] = getRGBPhosphorTriple(c, p);
-  return IG::PIXEL_DESC_RGBA8888_NATIVE.build(rn, gn, bn, (uInt8)0);
-}
-
 template <int outputBits>
 void FrameBuffer::renderOutput(IG::MutablePixmapView pix, TIA &tia)
 {
@@ -113,36 +82,17 @@ void FrameBuffer::renderOutput(IG::MutablePixmapView pix, TIA &tia)
 	assumeExpr(pix.size() == framePix.size());
 	assumeExpr(pix.format().bytesPerPixel() == outputBits / 8);
 	assumeExpr(framePix.format().bytesPerPixel() == 1);
-	if(myUsePhosphor)
-	{
-		uint8_t* prevFrame = prevFramebuffer.data();
-		pix.writeTransformed([this, &prevFrame](uint8_t p)
+	pix.writeTransformed([this](uint8_t p)
+		{
+			if constexpr(outputBits == 16)
 			{
-				if constexpr(outputBits == 16)
-				{
-					return getRGBPhosphor16(tiaColorMap32[p], tiaColorMap32[*prevFrame++]);
-				}
-				else
-				{
-					return getRGBPhosphor32(tiaColorMap32[p], tiaColorMap32[*prevFrame++]);
-				}
-			}, framePix);
-		memcpy(prevFramebuffer.data(), tia.frameBuffer(), sizeof(prevFramebuffer));
-	}
-	else
-	{
-		pix.writeTransformed([this](uint8_t p)
+				return tiaColorMap16[p];
+			}
+			else
 			{
-				if constexpr(outputBits == 16)
-				{
-					return tiaColorMap16[p];
-				}
-				else
-				{
-					return tiaColorMap32[p];
-				}
-			}, framePix);
-	}
+				return tiaColorMap32[p];
+			}
+		}, framePix);
 }
 
 void FrameBuffer::render(IG::MutablePixmapView pix, TIA &tia)
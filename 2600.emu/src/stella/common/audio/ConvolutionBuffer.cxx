@@ -15,31 +15,51 @@
 // this file, and for a DISCLAIMER OF ALL WARRANTIES.
 //============================================================================
 
+#include <cstring>
+
 #include "ConvolutionBuffer.hxx"
 
+namespace {
+
+  // Maps to a NEON/SSE register with GCC & Clang
+  using Float4 = float __attribute__((vector_size(16)));
+
+  inline Float4 loadFloat4(const float* ptr)
+  {
+    Float4 v;
+    std::memcpy(&v, ptr, sizeof(v));
+    return v;
+  }
+
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 ConvolutionBuffer::ConvolutionBuffer(uInt32 size)
-  : myData{make_unique<float[]>(size)},
-    mySize{size}
+  : myData{make_unique<float[]>(size + paddedSize(size))},
+    mySize{size},
+    myPaddedSize{paddedSize(size)}
 {
-  std::fill_n(myData.get(), mySize, 0.F);
+  std::fill_n(myData.get(), mySize + myPaddedSize, 0.F);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void ConvolutionBuffer::shift(float nextValue)
 {
   myData[myFirstIndex] = nextValue;
-  myFirstIndex = (myFirstIndex + 1) % mySize;
+  myData[myFirstIndex + mySize] = nextValue;
+  if (++myFirstIndex == mySize) myFirstIndex = 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 float ConvolutionBuffer::convoluteWith(const float* const kernel) const
 {
-  float result = 0.F;
+  // Taps past mySize read stale samples, but their kernel weight is zero
+  const float* data = myData.get() + myFirstIndex;
+  Float4 result{};
 
-  for (uInt32 i = 0; i < mySize; ++i) {
-    result += kernel[i] * myData[(myFirstIndex + i) % mySize];
+  for (uInt32 i = 0; i < myPaddedSize; i += 4) {
+    result += loadFloat4(kernel + i) * loadFloat4(data + i);
   }
 
-  return result;
+  return (result[0] + result[1]) + (result[2] + result[3]);
 }
@@ -28,16 +28,24 @@ class ConvolutionBuffer
 
     void shift(float nextValue);
 
+    // The kernel must hold paddedSize(size) taps with the ones past size zeroed
     float convoluteWith(const float* const kernel) const;
 
+    // Number of taps processed per convolution, a multiple of the SIMD width
+    static constexpr uInt32 paddedSize(uInt32 size) { return (size + 3) & ~3U; }
+
   private:
 
+    // The samples are stored twice in a row so a convolution can read them
+    // contiguously starting from myFirstIndex without wrapping
     unique_ptr<float[]> myData;
 
     uInt32 myFirstIndex{0};
 
     uInt32 mySize{0};
 
+    uInt32 myPaddedSize{0};
+
   private:
 
     ConvolutionBuffer() = delete;
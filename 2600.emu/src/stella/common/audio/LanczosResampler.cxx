@@ -70,7 +70,8 @@ LanczosResampler::LanczosResampler(
   //
   // -> we find N from fully reducing the fraction.
   myPrecomputedKernelCount{reducedDenominator(formatFrom.sampleRate, formatTo.sampleRate)},
-  myKernelSize{2 * kernelParameter},
+  // Kernels are zero padded to the stride ConvolutionBuffer processes per step
+  myKernelSize{ConvolutionBuffer::paddedSize(2 * kernelParameter)},
   myKernelParameter{kernelParameter},
   myHighPassL{HIGH_PASS_CUT_OFF, float(formatFrom.sampleRate)},
   myHighPassR{HIGH_PASS_CUT_OFF, float(formatFrom.sampleRate)},
@@ -80,11 +81,11 @@ LanczosResampler::LanczosResampler(
 
   if (myFormatFrom.stereo)
   {
-    myBufferL = make_unique<ConvolutionBuffer>(myKernelSize);
-    myBufferR = make_unique<ConvolutionBuffer>(myKernelSize);
+    myBufferL = make_unique<ConvolutionBuffer>(2 * kernelParameter);
+    myBufferR = make_unique<ConvolutionBuffer>(2 * kernelParameter);
   }
   else
-    myBuffer = make_unique<ConvolutionBuffer>(myKernelSize);
+    myBuffer = make_unique<ConvolutionBuffer>(2 * kernelParameter);
 
   precomputeKernels();
 }
@@ -144,7 +145,7 @@ void LanczosResampler::fillFragment(float* fragment, uInt32 length)
 
   for (uInt32 i = 0; i < outputSamples; ++i) {
     const float* kernel = myPrecomputedKernels.get() + (myCurrentKernelIndex * myKernelSize);
-    myCurrentKernelIndex = (myCurrentKernelIndex + 1) % myPrecomputedKernelCount;
+    if (++myCurrentKernelIndex == myPrecomputedKernelCount) myCurrentKernelIndex = 0;
 
     if (myFormatFrom.stereo) {
       const float sampleL = myBufferL->convoluteWith(kernel);
@@ -166,11 +167,15 @@ void LanczosResampler::fillFragment(float* fragment, uInt32 length)
     }
 
     myTimeIndex += myFormatFrom.sampleRate;
+    if (myTimeIndex < myFormatTo.sampleRate) continue;
 
-    const uInt32 samplesToShift = myTimeIndex / myFormatTo.sampleRate;
-    if (samplesToShift == 0) continue;
+    // Usually at most a couple of steps, cheaper than a division per sample
+    uInt32 samplesToShift = 0;
+    do {
+      myTimeIndex -= myFormatTo.sampleRate;
+      ++samplesToShift;
+    } while (myTimeIndex >= myFormatTo.sampleRate);
 
-    myTimeIndex %= myFormatTo.sampleRate;
     shiftSamples(samplesToShift);
   }
 }
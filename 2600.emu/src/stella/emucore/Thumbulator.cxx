@@ -135,6 +135,8 @@ Thumbulator::Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, uInt32 rom_size
     cStart{c_start},
     cStack{c_stack},
     decodedRom{make_unique<Op[]>(romSize / 2)},  // NOLINT
+    romBlockLength{make_unique<uInt8[]>(romSize / 2)},  // NOLINT
+    decodedRam{make_unique<DecodedRamOp[]>(RAMSIZE / 2)},  // NOLINT
     ram{ram_ptr},
     configuration{configurefor},
     myCartridge{cartridge}
@@ -142,6 +144,17 @@ Thumbulator::Thumbulator(const uInt16* rom_ptr, uInt16* ram_ptr, uInt32 rom_size
   for(uInt32 i = 0; i < romSize / 2; ++i)
     decodedRom[i] = decodeInstructionWord(CONV_RAMROM(rom[i]));
 
+  // scan backwards so each entry extends the block that follows it
+  uInt32 nextLength = 0;
+  for(uInt32 i = romSize / 2; i-- > 0;)
+  {
+    if(isBlockEnd(decodedRom[i], CONV_RAMROM(rom[i])))
+      nextLength = 1;
+    else
+      nextLength = std::min(nextLength + 1, 255U);
+    romBlockLength[i] = nextLength;
+  }
+
   setConsoleTiming(ConsoleTiming::ntsc);
 #ifndef UNSAFE_OPTIMIZATIONS
   trapFatalErrors(traponfatal);
@@ -159,7 +172,7 @@ string Thumbulator::doRun(uInt32& cycles, bool irqDrivenAudio)
   reset();
   for(;;)
   {
-    if(execute()) break;
+    if(executeBlock()) break;
 #ifndef UNSAFE_OPTIMIZATIONS
     if(_stats.instructions > 500000) // way more than would otherwise be possible
       throw runtime_error("instructions > 500000");
@@ -1092,10 +1105,68 @@ Thumbulator::Op Thumbulator::decodeInstructionWord(uint16_t inst) {
   return Op::invalid;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool Thumbulator::isBlockEnd(Op op, uInt32 inst)
+{
+  switch(op)
+  {
+    case Op::invalid:
+    case Op::b1: case Op::b2:
+    case Op::blx1: case Op::blx2:
+    case Op::bx:
+    case Op::bkpt:
+    case Op::swi:
+    case Op::pop:
+      return true;
+    // hi register forms that may target the pc
+    case Op::add4: case Op::mov3:
+      return ((inst & 0x7) | ((inst >> 4) & 0x8)) == 15;
+    default:
+      return false;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int Thumbulator::executeBlock()
+{
+  // Runs a predecoded straight-line block of ROM code without going through
+  // the generic fetch/decode path, falls back to execute() for anything else
+  const uInt32 instructionPtr = read_register(15) - 2;
+#ifndef UNSAFE_OPTIMIZATIONS
+  if((instructionPtr & 0xF0000000) != 0 || instructionPtr >= romSize || instructionPtr < 0x50)
+#else
+  if((instructionPtr & 0xF0000000) != 0)
+#endif
+    return execute();
+
+  uInt32 idx = (instructionPtr & ROMADDMASK) >> 1;
+  const uInt32 length = romBlockLength[idx];
+  for(uInt32 i = 0; i < length; ++i, ++idx)
+  {
+    const uInt32 pc = instructionPtr + 4 + (i << 1);
+  #ifdef THUMB_CYCLE_COUNT
+    // keep the prefetch cycle accounting of the generic path
+    const uInt32 inst = fetch16(pc - 4);
+  #else
+    const uInt32 inst = CONV_RAMROM(rom[idx]);
+  #endif
+    write_register(15, pc, false);
+    DO_DISS(statusMsg << Base::HEX8 << (pc-5) << ": " << Base::HEX4 << inst << " ");
+  #ifndef UNSAFE_OPTIMIZATIONS
+    ++_stats.instructions;
+  #endif
+    if(int result = executeOp(decodedRom[idx], inst, pc); result)
+      return result;
+    if(reg_norm[15] != pc) // flow changed
+      break;
+  }
+  return 0;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Thumbulator::execute()
 {
-  uInt32 pc, sp, inst, ra, rb, rc, rm, rd, rn, rs, op;
+  uInt32 pc, inst;
 
   pc = read_register(15);
 
@@ -1114,12 +1185,28 @@ int Thumbulator::execute()
 #ifndef UNSAFE_OPTIMIZATIONS
   if ((instructionPtr & 0xF0000000) == 0 && instructionPtr < romSize)
     decodedOp = decodedRom[instructionPtr >> 1];
+  else if ((instructionPtr & 0xF0000000) == 0x40000000)
+  {
+    // RAM code can be rewritten by the 6507 side, so validate the cached entry
+    DecodedRamOp& cached = decodedRam[(instructionPtr & RAMADDMASK) >> 1];
+    if(cached.op == Op::invalid || cached.inst != inst)
+      cached = {static_cast<uInt16>(inst), decodeInstructionWord(inst)};
+    decodedOp = cached.op;
+  }
   else
     decodedOp = decodeInstructionWord(inst);
 #else
   decodedOp = decodedRom[(instructionPtr & ROMADDMASK) >> 1];
 #endif
 
+  return executeOp(decodedOp, inst, pc);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int Thumbulator::executeOp(Op decodedOp, uInt32 inst, uInt32 pc)
+{
+  uInt32 sp, ra, rb, rc, rm, rd, rn, rs, op;
+
 #ifdef COUNT_OPS
   ++opCount[int(decodedOp)];
 #endif
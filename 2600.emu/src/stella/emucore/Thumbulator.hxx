@@ -237,6 +237,7 @@ class Thumbulator
     void updateTimer(uInt32 cycles);
 
     static Op decodeInstructionWord(uint16_t inst);
+    static bool isBlockEnd(Op op, uInt32 inst);
 
     void do_zflag(uInt32 x);
     void do_nflag(uInt32 x);
@@ -256,6 +257,8 @@ class Thumbulator
     void dump_regs();
   #endif
     int execute();
+    int executeBlock();
+    int executeOp(Op decodedOp, uInt32 inst, uInt32 pc);
     int reset();
 
   #ifdef THUMB_CYCLE_COUNT
@@ -274,6 +277,16 @@ class Thumbulator
     uInt32 cStart{0};
     uInt32 cStack{0};
     const unique_ptr<Op[]> decodedRom;  // NOLINT
+    // number of straight-line instructions from each ROM halfword up to and
+    // including the next branch, capped at 255
+    const unique_ptr<uInt8[]> romBlockLength;  // NOLINT
+    // decode cache for code running from RAM (e.g. CDF/DPC+ drivers), an
+    // entry is only valid while its instruction word is unchanged
+    struct DecodedRamOp {
+      uInt16 inst{0};
+      Op op{Op::invalid};
+    };
+    const unique_ptr<DecodedRamOp[]> decodedRam;  // NOLINT
     uInt16* ram{nullptr};
     std::array<uInt32, 16> reg_norm; // normal execution mode, do not have a thread mode
     uInt32 cpsr{0};
@@ -244,6 +244,17 @@ class CustomAudioOptionView : public AudioOptionView, public MainAppHelper<Custo
 		reSidSamplingItem
 	};
 
+	BoolMenuItem reSidThreaded
+	{
+		"Run ReSID On Separate Thread", &defaultFace(),
+		(bool)system().optionReSidThreaded,
+		[this](BoolMenuItem &item)
+		{
+			system().optionReSidThreaded = item.flipBoolValue(*this);
+			system().setReSidThreaded(system().optionReSidThreaded);
+		}
+	};
+
 	TextMenuItem::SelectDelegate setSidEngineDel()
 	{
 		return [this](TextMenuItem &item)
@@ -268,6 +279,7 @@ public:
 		loadStockItems();
 		item.emplace_back(&sidEngine);
 		item.emplace_back(&reSidSampling);
+		item.emplace_back(&reSidThreaded);
 	}
 };
 
@@ -179,6 +179,7 @@ void C64System::applyInitialOptionResources()
 	setBorderMode(optionBorderMode);
 	setSidEngine(optionSidEngine);
 	setReSidSampling(optionReSidSampling);
+	setReSidThreaded(optionReSidThreaded);
 }
 
 int systemCartType(ViceSystem system)
@@ -481,17 +482,40 @@ void C64System::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio
 {
 	audioPtr = audio;
 	setCanvasSkipFrame(!video);
-	execC64Frame();
-	if(video)
+	if(video && canRenderCanvasDirect(*video))
+	{
+		auto img = video->startFrameWithFormat(taskCtx, canvasSrcPix.desc());
+		startCanvasDirectRender(img.pixmap());
+		execC64Frame();
+		finishCanvasDirectRender();
+		img.endFrame();
+	}
+	else
 	{
-		video->startFrameWithAltFormat(taskCtx, canvasSrcPix);
+		execC64Frame();
+		if(video)
+		{
+			video->startFrameWithAltFormat(taskCtx, canvasSrcPix);
+		}
 	}
 	audioPtr = {};
 }
 
 void C64System::renderFramebuffer(EmuVideo &video)
 {
-	video.startFrameWithAltFormat({}, canvasSrcPix);
+	if(canRenderCanvasDirect(video))
+	{
+		auto img = video.startFrameWithFormat({}, canvasSrcPix.desc());
+		startCanvasDirectRender(img.pixmap());
+		finishCanvasDirectRender();
+		img.endFrame();
+	}
+	else
+	{
+		// the canvas pixmap is stale if previous frames were rendered directly
+		refreshActiveCanvas();
+		video.startFrameWithAltFormat({}, canvasSrcPix);
+	}
 }
 
 void C64System::configAudioRate(FrameTime outputFrameTime, int outputRate)
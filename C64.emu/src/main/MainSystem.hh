@@ -57,6 +57,7 @@ enum
 	CFGKEY_DEFAULT_MODEL = 282, CFGKEY_DEFAULT_PALETTE_NAME = 283,
 	CFGKEY_DRIVE8_TYPE = 284, CFGKEY_DRIVE9_TYPE = 285,
 	CFGKEY_DRIVE10_TYPE = 286, CFGKEY_DRIVE11_TYPE = 287,
+	CFGKEY_RESID_THREADED = 288,
 };
 
 enum Vic20Ram : uint8_t
@@ -94,6 +95,9 @@ public:
 	std::string defaultPaletteName{};
 	std::string lastMissingSysFile;
 	IG::PixmapView canvasSrcPix{};
+	IG::MutablePixmapView canvasDestPix{};
+	IG::WPt canvasSrcOffset{};
+	bool canvasDestRendered{};
 	PixelFormat pixFmt{};
 	ViceSystem currSystem{};
 	std::atomic_bool runningFrame{};
@@ -116,6 +120,7 @@ public:
 		optionIsValidWithMax<1, uint8_t>};
 	Byte1Option optionReSidSampling{CFGKEY_RESID_SAMPLING, SID_RESID_SAMPLING_INTERPOLATION, false,
 		optionIsValidWithMax<3, uint8_t>};
+	Byte1Option optionReSidThreaded{CFGKEY_RESID_THREADED, 0};
 	Byte1Option optionSwapJoystickPorts{CFGKEY_SWAP_JOYSTICK_PORTS, JoystickMode::NORMAL, false,
 		optionIsValidWithMax<JoystickMode::KEYBOARD>};
 	Byte1Option optionAutostartOnLaunch{CFGKEY_AUTOSTART_ON_LOAD, 1};
@@ -161,6 +166,7 @@ public:
 	void setBorderMode(int mode);
 	void setSidEngine(int engine);
 	void setReSidSampling(int sampling);
+	void setReSidThreaded(bool on);
 	void setDriveTrueEmulation(bool on);
 	bool driveTrueEmulation() const;
 	void setAutostartWarp(bool on);
@@ -229,6 +235,10 @@ protected:
 	void startCanvasRunningFrame();
 	void setCanvasSkipFrame(bool on);
 	bool updateCanvasPixelFormat(struct video_canvas_s *, PixelFormat);
+	bool canRenderCanvasDirect(const EmuVideo &) const;
+	void startCanvasDirectRender(IG::MutablePixmapView);
+	void finishCanvasDirectRender();
+	void refreshActiveCanvas();
 	void tryLoadingSplitVic20Cart();
 };
 
@@ -183,6 +183,7 @@ bool C64System::readConfig(ConfigType type, MapIO &io, unsigned key, size_t read
 			case CFGKEY_SYSTEM_FILE_PATH:
 				return readStringOptionValue<FS::PathString>(io, readSize, [&](auto &&path){sysFilePath[0] = IG_forward(path);});
 			case CFGKEY_RESID_SAMPLING: return optionReSidSampling.readFromIO(io, readSize);
+			case CFGKEY_RESID_THREADED: return optionReSidThreaded.readFromIO(io, readSize);
 		}
 	}
 	else if(type == ConfigType::CORE)
@@ -237,6 +238,7 @@ void C64System::writeConfig(ConfigType type, FileIO &io)
 		optionCropNormalBorders.writeWithKeyIfNotDefault(io);
 		optionSidEngine.writeWithKeyIfNotDefault(io);
 		optionReSidSampling.writeWithKeyIfNotDefault(io);
+		optionReSidThreaded.writeWithKeyIfNotDefault(io);
 		writeStringOptionValue(io, CFGKEY_SYSTEM_FILE_PATH, sysFilePath[0]);
 	}
 	else if(type == ConfigType::CORE)
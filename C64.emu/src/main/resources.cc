@@ -143,6 +143,12 @@ int C64System::reSidSampling() const
 	return intResource("SidResidSampling");
 }
 
+void C64System::setReSidThreaded(bool on)
+{
+	logMsg("set ReSID threaded %d", on);
+	setIntResource("SidResidThreaded", on);
+}
+
 void C64System::setVirtualDeviceTraps(bool on)
 {
 	setIntResource("VirtualDevice8", on);
@@ -139,12 +139,31 @@ void video_canvas_refresh(struct video_canvas_s *c, unsigned int xs, unsigned in
 	w *= c->videoconfig->scalex;
 	yi *= c->videoconfig->scaley;
 	h *= c->videoconfig->scaley;
+	auto &sys = c64Sys(c);
+	if(sys.canvasDestPix.data() && c == sys.activeCanvas)
+	{
+		// render only the visible sub-view straight into the locked video texture
+		auto destPix = sys.canvasDestPix;
+		auto offset = sys.canvasSrcOffset;
+		int x0 = std::max((int)xi, offset.x);
+		int y0 = std::max((int)yi, offset.y);
+		int x1 = std::min(int(xi + w), offset.x + destPix.w());
+		int y1 = std::min(int(yi + h), offset.y + destPix.h());
+		if(x0 >= x1 || y0 >= y1)
+			return;
+		xs += (x0 - (int)xi) / c->videoconfig->scalex;
+		ys += (y0 - (int)yi) / c->videoconfig->scaley;
+		sys.plugin.video_canvas_render(c, (uint8_t*)destPix.data(), x1 - x0, y1 - y0, xs, ys,
+			x0 - offset.x, y0 - offset.y, destPix.pitchBytes());
+		sys.canvasDestRendered = true;
+		return;
+	}
 	auto pixView = pixmapView(c);
 
 	w = std::min((int)w, pixView.w());
 	h = std::min((int)h, pixView.h());
 
-	c64Sys(c).plugin.video_canvas_render(c, (uint8_t*)pixView.data(), w, h, xs, ys, xi, yi, pixView.pitchBytes());
+	sys.plugin.video_canvas_render(c, (uint8_t*)pixView.data(), w, h, xs, ys, xi, yi, pixView.pitchBytes());
 }
 
 void C64System::resetCanvasSourcePixmap(struct video_canvas_s *c)
@@ -170,10 +189,12 @@ void C64System::resetCanvasSourcePixmap(struct video_canvas_s *c)
 		int width = 320+(xBorderSize*2 - startX*2);
 		int widthPadding = startX*2;
 		canvasSrcPix = pixmapView(c).subView({startX, startY}, {width, height});
+		canvasSrcOffset = {startX, startY};
 	}
 	else
 	{
 		canvasSrcPix = pixmapView(c);
+		canvasSrcOffset = {};
 	}
 }
 
@@ -217,6 +238,33 @@ bool C64System::updateCanvasPixelFormat(struct video_canvas_s *c, IG::PixelForma
 	return true;
 }
 
+void C64System::refreshActiveCanvas()
+{
+	if(activeCanvas && activeCanvas->pixmapData)
+		refreshFullCanvas(activeCanvas);
+}
+
+bool C64System::canRenderCanvasDirect(const EmuVideo &video) const
+{
+	return activeCanvas && canvasSrcPix.data() && video.renderPixelFormat() == canvasSrcPix.format();
+}
+
+void C64System::startCanvasDirectRender(IG::MutablePixmapView pix)
+{
+	assumeExpr(pix.size() == canvasSrcPix.size());
+	canvasDestPix = pix;
+	canvasDestRendered = false;
+}
+
+void C64System::finishCanvasDirectRender()
+{
+	// the destination buffer may not keep the previous frame's contents,
+	// so fill it from the draw buffer if VICE skipped the refresh this frame
+	if(!canvasDestRendered)
+		refreshActiveCanvas();
+	canvasDestPix = {};
+}
+
 void video_canvas_resize(struct video_canvas_s *c, char resize_canvas)
 {
 	int x = c->draw_buffer->canvas_width;
@@ -50,8 +50,205 @@ extern "C" {
 #include "resid/sid.h"
 /* resid-dtv/ is used for DTVSID, but the API is the same */
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace reSID;
 
+/* Threaded synthesis (SidResidThreaded resource):
+
+   The emulation thread only tracks reSID's sample timing, which tells it how
+   many samples each clock call produces, and queues the clock calls and
+   register writes in order. A worker thread replays the queue on the real SID
+   and feeds its output into a FIFO primed with silence, so the samples handed
+   back to VICE lag the emulation by a fixed latency instead of being computed
+   inline. Register reads (OSC3/ENV3 and the bus value), resets, and snapshot
+   access wait for the worker to drain the queue first, so the chip state they
+   see is identical to inline synthesis. */
+
+/* gives access to the protected sample timing state of reSID */
+class TimedSID : public reSID::SID
+{
+public:
+    /* same sample count and delta_t bookkeeping as SID::clock(), minus the synthesis */
+    int clock_timing(cycle_count& delta_t, int n, cycle_count& offset) const
+    {
+        const cycle_count round = (sampling == SAMPLE_FAST) ? (1 << (FIXP_SHIFT - 1)) : 0;
+        int s;
+
+        for (s = 0; s < n; s++) {
+            cycle_count next_sample_offset = offset + cycles_per_sample + round;
+            cycle_count delta_t_sample = next_sample_offset >> FIXP_SHIFT;
+
+            if (delta_t_sample > delta_t) {
+                delta_t_sample = delta_t;
+            }
+
+            if ((delta_t -= delta_t_sample) == 0) {
+                offset -= delta_t_sample << FIXP_SHIFT;
+                break;
+            }
+
+            offset = (next_sample_offset & FIXP_MASK) - round;
+        }
+
+        return s;
+    }
+
+    cycle_count get_sample_offset() const { return sample_offset; }
+
+    /* number of samples produced in the given number of cycles */
+    int samples_in_cycles(cycle_count cycles) const
+    {
+        return (int)(((int64_t)cycles << FIXP_SHIFT) / cycles_per_sample);
+    }
+};
+
+class ReSIDThread
+{
+public:
+    ReSIDThread(TimedSID& sid);
+    ~ReSIDThread();
+    int clock(cycle_count& delta_t, short* buf, int n, int interleave);
+    void write(reg8 addr, reg8 value);
+    void sync();
+
+private:
+    struct Op
+    {
+        cycle_count delta_t;
+        int n;
+        int addr; /* -1 for clock operations */
+        reg8 value;
+    };
+
+    static constexpr int fifo_size = 1 << 15;
+    static constexpr cycle_count latency_cycles = 40000; /* about 2 frames */
+
+    TimedSID& sid;
+    std::mutex mutex;
+    std::condition_variable work_cond, space_cond, done_cond;
+    std::vector<Op> ops, worker_ops;
+    std::vector<short> fifo, worker_buf;
+    int fifo_read = 0;
+    int fifo_count = 0;
+    cycle_count sample_offset;
+    bool busy = false;
+    bool quit = false;
+    std::thread thread;
+
+    void run();
+    void push_samples(const short* samples, int n);
+};
+
+ReSIDThread::ReSIDThread(TimedSID& sid):
+    sid{sid},
+    fifo(fifo_size),
+    sample_offset{sid.get_sample_offset()}
+{
+    fifo_count = std::min(sid.samples_in_cycles(latency_cycles), fifo_size / 2);
+    thread = std::thread([this]() { run(); });
+}
+
+ReSIDThread::~ReSIDThread()
+{
+    {
+        std::lock_guard lock{mutex};
+        quit = true;
+    }
+    work_cond.notify_one();
+    thread.join();
+}
+
+int ReSIDThread::clock(cycle_count& delta_t, short* buf, int n, int interleave)
+{
+    cycle_count op_delta_t = delta_t;
+    int count = sid.clock_timing(delta_t, n, sample_offset);
+    {
+        std::lock_guard lock{mutex};
+        ops.push_back({op_delta_t, n, -1, 0});
+    }
+    work_cond.notify_one();
+    for (int s = 0; s < count;) {
+        std::unique_lock lock{mutex};
+        done_cond.wait(lock, [&]() { return fifo_count > 0; });
+        int chunk = std::min({count - s, fifo_count, fifo_size - fifo_read});
+        for (int i = 0; i < chunk; i++) {
+            buf[(s + i) * interleave] = fifo[fifo_read + i];
+        }
+        fifo_read = (fifo_read + chunk) & (fifo_size - 1);
+        fifo_count -= chunk;
+        s += chunk;
+        lock.unlock();
+        space_cond.notify_one();
+    }
+    return count;
+}
+
+void ReSIDThread::write(reg8 addr, reg8 value)
+{
+    {
+        std::lock_guard lock{mutex};
+        ops.push_back({0, 0, (int)addr, value});
+    }
+    work_cond.notify_one();
+}
+
+void ReSIDThread::sync()
+{
+    std::unique_lock lock{mutex};
+    done_cond.wait(lock, [&]() { return ops.empty() && !busy; });
+}
+
+void ReSIDThread::run()
+{
+    std::unique_lock lock{mutex};
+    for (;;) {
+        work_cond.wait(lock, [&]() { return quit || !ops.empty(); });
+        if (ops.empty()) {
+            return;
+        }
+        worker_ops.swap(ops);
+        busy = true;
+        lock.unlock();
+        for (auto& op : worker_ops) {
+            if (op.addr >= 0) {
+                sid.write(op.addr, op.value);
+                continue;
+            }
+            if ((int)worker_buf.size() < op.n) {
+                worker_buf.resize(op.n);
+            }
+            cycle_count delta_t = op.delta_t;
+            int n = sid.clock(delta_t, worker_buf.data(), op.n, 1);
+            push_samples(worker_buf.data(), n);
+        }
+        worker_ops.clear();
+        lock.lock();
+        busy = false;
+        done_cond.notify_all();
+    }
+}
+
+void ReSIDThread::push_samples(const short* samples, int n)
+{
+    while (n) {
+        std::unique_lock lock{mutex};
+        space_cond.wait(lock, [&]() { return fifo_count < fifo_size; });
+        int write_pos = (fifo_read + fifo_count) & (fifo_size - 1);
+        int chunk = std::min({n, fifo_size - fifo_count, fifo_size - write_pos});
+        std::copy_n(samples, chunk, &fifo[write_pos]);
+        fifo_count += chunk;
+        samples += chunk;
+        n -= chunk;
+        lock.unlock();
+        done_cond.notify_all();
+    }
+}
+
 extern "C" {
 
 struct sound_s
@@ -61,6 +258,9 @@ struct sound_s
 
     /* resid sid implementation */
     reSID::SID *sid;
+
+    /* synthesis worker when SidResidThreaded is set, otherwise NULL */
+    ReSIDThread *thread;
 };
 
 typedef struct sound_s sound_t;
@@ -88,7 +288,8 @@ static sound_t *resid_open(uint8_t *sidstate)
     int i;
 
     psid = new sound_t;
-    psid->sid = new reSID::SID;
+    psid->sid = new TimedSID;
+    psid->thread = NULL;
 
     for (i = 0x00; i <= 0x18; i++) {
         psid->sid->write(i, sidstate[i]);
@@ -97,6 +298,19 @@ static sound_t *resid_open(uint8_t *sidstate)
     return psid;
 }
 
+static void resid_sync(sound_t *psid)
+{
+    if (psid->thread) {
+        psid->thread->sync();
+    }
+}
+
+static void resid_stop_thread(sound_t *psid)
+{
+    delete psid->thread;
+    psid->thread = NULL;
+}
+
 static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
 {
     sampling_method method;
@@ -104,7 +318,9 @@ static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
     char method_text[100];
     double passband, gain;
     int filters_enabled, model, sampling, passband_percentage, gain_percentage, filter_bias_mV;
-    int rawoutput;
+    int rawoutput, threaded;
+
+    resid_stop_thread(psid);
 
     if (resources_get_int("SidFilters", &filters_enabled) < 0) {
         return 0;
@@ -225,17 +441,27 @@ static int resid_init(sound_t *psid, int speed, int cycles_per_sec, int factor)
 
     psid->sid->enable_raw_debug_output(rawoutput);
 
-    log_message(LOG_DEFAULT, "reSID: %s, filter %s, sampling rate %dHz - %s%s",
+    /* the speed factor path resamples through a shared buffer, keep it inline */
+    if (resources_get_int("SidResidThreaded", &threaded) < 0) {
+        threaded = 0;
+    }
+    if (threaded && factor == 1000) {
+        psid->thread = new ReSIDThread(*static_cast<TimedSID *>(psid->sid));
+    }
+
+    log_message(LOG_DEFAULT, "reSID: %s, filter %s, sampling rate %dHz - %s%s%s",
                 model_text,
                 filters_enabled ? "on" : "off",
                 speed, method_text,
-                rawoutput ? ", raw debug output enabled": "");
+                rawoutput ? ", raw debug output enabled": "",
+                psid->thread ? ", threaded" : "");
 
     return 1;
 }
 
 static void resid_close(sound_t *psid)
 {
+    resid_stop_thread(psid);
     delete psid->sid;
     delete psid;
 
@@ -247,16 +473,22 @@ static void resid_close(sound_t *psid)
 
 static uint8_t resid_read(sound_t *psid, uint16_t addr)
 {
+    resid_sync(psid);
     return psid->sid->read(addr);
 }
 
 static void resid_store(sound_t *psid, uint16_t addr, uint8_t byte)
 {
+    if (psid->thread) {
+        psid->thread->write(addr, byte);
+        return;
+    }
     psid->sid->write(addr, byte);
 }
 
 static void resid_reset(sound_t *psid, CLOCK cpu_clk)
 {
+    resid_sync(psid);
     psid->sid->reset();
 }
 
@@ -270,6 +502,12 @@ static int resid_calculate_samples(sound_t *psid, short *pbuf, int nr,
 
     /* Tried not to mess with resid during 64-bit conversion. clock(...) wants to modify *delta_t ... */
 
+    if (psid->thread) {
+        retval = psid->thread->clock(int_delta_t, pbuf, nr, interleave);
+        (*delta_t) += int_delta_t - int_delta_t_original;
+        return retval;
+    }
+
     if (psid->factor == 1000) {
         retval = psid->sid->clock(int_delta_t, pbuf, nr, interleave);
         (*delta_t) += int_delta_t - int_delta_t_original;
@@ -290,6 +528,7 @@ static char *resid_dump_state(sound_t *psid)
     char strbuf[0x400];
     /* when sound is disabled *psid is NULL */
     if (psid && psid->sid) {
+        resid_sync(psid);
         state = psid->sid->read_state();
     } else {
         return lib_strdup("no state available when sound is disabled.");
@@ -332,6 +571,7 @@ static void resid_state_read(sound_t *psid, sid_snapshot_state_t *sid_state)
 
     /* when sound is disabled *psid is NULL */
     if (psid) {
+        resid_sync(psid);
         state = psid->sid->read_state();
     }
 
@@ -397,6 +637,7 @@ static void resid_state_write(sound_t *psid, sid_snapshot_state_t *sid_state)
     state.write_address = (reg8)sid_state->write_address;
     state.voice_mask = (reg4)sid_state->voice_mask;
 
+    resid_sync(psid);
     psid->sid->write_state((const reSID::SID::State)state);
 }
 
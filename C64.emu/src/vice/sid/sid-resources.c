@@ -63,6 +63,7 @@ static int sid_resid_8580_passband;
 static int sid_resid_8580_gain;
 static int sid_resid_8580_filter_bias;
 static int sid_resid_enable_raw_output;
+static int sid_resid_threaded;
 #endif
 int sid_stereo = 0;
 int checking_sid_stereo;
@@ -154,6 +155,15 @@ static int set_sid_resid_enable_raw_output(int val, void *param)
 
     return 0;
 }
+
+static int set_sid_resid_threaded(int val, void *param)
+{
+    sid_resid_threaded = val ? 1 : 0;
+
+    sid_state_changed = 1;
+
+    return 0;
+}
 #endif
 
 static int set_sid_stereo(int val, void *param)
@@ -384,6 +394,8 @@ void sid_set_enable(int value)
 static const resource_int_t resid_resources_int[] = {
     { "SidResidEnableRawOutput", 0, RES_EVENT_NO, NULL,
       &sid_resid_enable_raw_output, set_sid_resid_enable_raw_output, NULL },
+    { "SidResidThreaded", 0, RES_EVENT_NO, NULL,
+      &sid_resid_threaded, set_sid_resid_threaded, NULL },
     { "SidResidSampling", SID_RESID_SAMPLING_RESAMPLING, RES_EVENT_NO, NULL,
       &sid_resid_sampling, set_sid_resid_sampling, NULL },
     { "SidResidPassband", 90, RES_EVENT_NO, NULL,
@@ -20,6 +20,7 @@ pathUtils.cc \
 RecentContent.cc \
 ToggleInput.cc \
 TurboInput.cc \
+VideoFrameBlend.cc \
 VideoImageEffect.cc \
 VideoImageOverlay.cc \
 gui/AudioOptionView.cc \
@@ -18,6 +18,7 @@
 #include <emuframework/config.hh>
 #include <emuframework/Option.hh>
 #include <imagine/base/Timer.hh>
+#include <imagine/thread/WorkThread.hh>
 #include <imagine/fs/FSDefs.hh>
 #include <imagine/util/enum.hh>
 #include <string>
@@ -85,6 +86,10 @@ private:
 	Timer autoSaveTimer;
 	SteadyClockTimePoint autoSaveTimerStartTime{};
 	SteadyClockTime autoSaveTimerElapsedTime{};
+	WorkThread stateWriteThread;
+
+	bool saveInBackground();
+	void waitForStateWrite();
 public:
 	Minutes autosaveTimerMins{};
 	AutosaveLaunchMode autosaveLaunchMode{};
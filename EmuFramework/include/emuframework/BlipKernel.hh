@@ -0,0 +1,80 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <cstdint>
+#if defined __ARM_NEON
+#include <arm_neon.h>
+#elif defined __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Band-limited step synthesis kernels shared by the Blip_Buffer copies in the emulator cores
+
+namespace EmuEx::Blip
+{
+
+// Expands a Blip_Synth impulse table, which stores half of the impulse for every phase with taps
+// res entries apart and mirrors it for the other half, into one contiguous kernel of width taps
+// per phase in output order. Must be redone whenever the impulse table changes.
+constexpr void expandKernels(int16_t *kernels, const int16_t *impulses, int res, int width)
+{
+	const int mid = width / 2 - 1;
+	for(int phase = 0; phase < res; phase++)
+	{
+		auto k = kernels + phase * width;
+		for(int i = 0; i <= mid; i++)
+			k[i] = impulses[res - phase + res * i];
+		for(int i = mid + 1; i < width; i++)
+			k[i] = impulses[phase + res * (width - 1 - i)];
+	}
+}
+
+// Adds kernel * delta to buf, 4 taps at a time. Products wrap like the scalar
+// (int32_t)kernel[i] * delta the Blip_Synth code used before.
+template<int width>
+inline void addImpulse(int32_t *__restrict buf, const int16_t *__restrict kernel, int32_t delta)
+{
+	static_assert(width % 4 == 0);
+	#if defined __ARM_NEON
+	const int32x4_t deltaV = vdupq_n_s32(delta);
+	for(int i = 0; i < width; i += 4)
+	{
+		vst1q_s32(buf + i, vmlaq_s32(vld1q_s32(buf + i), vmovl_s16(vld1_s16(kernel + i)), deltaV));
+	}
+	#elif defined __SSE2__
+	// SSE2 has no 32-bit multiply, so split delta into signed 16-bit halves and use pmaddwd
+	// with a zero in the odd lanes: kernel * delta = kernel * lo + ((kernel * hi) << 16)
+	const int16_t lo = delta;
+	const int16_t hi = (uint32_t(delta) - uint32_t(lo)) >> 16;
+	const __m128i loV = _mm_set1_epi32(uint16_t(lo));
+	const __m128i hiV = _mm_set1_epi32(uint16_t(hi));
+	for(int i = 0; i < width; i += 4)
+	{
+		auto k = _mm_loadl_epi64((const __m128i*)(kernel + i));
+		k = _mm_unpacklo_epi16(k, k);
+		auto product = _mm_add_epi32(_mm_madd_epi16(k, loV), _mm_slli_epi32(_mm_madd_epi16(k, hiV), 16));
+		_mm_storeu_si128((__m128i*)(buf + i), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(buf + i)), product));
+	}
+	#else
+	for(int i = 0; i < width; i++)
+	{
+		buf[i] += int32_t(uint32_t(kernel[i]) * uint32_t(delta));
+	}
+	#endif
+}
+
+}
@@ -191,6 +191,8 @@ public:
 	void showEmulation();
 	void startEmulation();
 	void pauseEmulation();
+	MemoryUsageReport memoryUsage();
+	void freeEmulationCaches();
 	void showUI(bool updateTopView = true);
 	void launchSystem(const Input::Event &);
 	static bool hasArchiveExtension(std::string_view name);
@@ -554,6 +556,7 @@ protected:
 	IG_UseMemberIf(Config::TRANSLUCENT_SYSTEM_UI, bool, layoutBehindSystemUI){};
 public:
 	bool showHiddenFilesInPicker{};
+	bool lowMemoryMode{};
 	IG_UseMemberIf(Config::envIsAndroid, bool, useSustainedPerformanceMode){};
 	IG_UseMemberIf(Config::Input::BLUETOOTH && Config::BASE_CAN_BACKGROUND_APP, bool, keepBluetoothActive){};
 	IG_UseMemberIf(Config::Input::DEVICE_HOTSWAP, bool, notifyOnInputDeviceChange){true};
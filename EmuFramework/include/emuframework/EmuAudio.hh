@@ -55,13 +55,25 @@ public:
 		MULTI_UNDERRUN
 	};
 
+	// Buffer handed out by frameWriteBuffer() that commitFrames() hasn't consumed yet
+	enum class PendingWrite : uint8_t
+	{
+		NONE,
+		RING_BUFFER,
+		SCRATCH
+	};
+
 	EmuAudio(const IG::Audio::Manager &audioManager);
 	void open();
 	void start(FloatSeconds bufferDuration);
 	void stop();
 	void close();
 	void flush();
+	void freeBuffer();
 	void writeFrames(const void *samples, size_t framesToWrite);
+	// Returns space for up to maxFrames that the caller fills in place, followed by commitFrames()
+	void *frameWriteBuffer(size_t maxFrames);
+	void commitFrames(size_t frames);
 	void setRate(int rate);
 	int rate() const { return rate_; }
 	int maxRate() const { return defaultRate; }
@@ -85,6 +97,8 @@ protected:
 	IG::Audio::OutputStream audioStream;
 	const IG::Audio::Manager &audioManager;
 	RingBuffer rBuff;
+	std::unique_ptr<char[]> scratchBuff;
+	size_t scratchBuffSize{};
 	SteadyClockTimePoint lastUnderrunTime{};
 	double speedMultiplier{1.};
 	size_t targetBufferFillBytes{};
@@ -98,6 +112,7 @@ protected:
 	AudioFlags flags{defaultAudioFlags};
 	IG_UseMemberIf(IG::Audio::Config::MULTIPLE_SYSTEM_APIS, IG::Audio::Api, audioAPI){};
 	bool addSoundBuffersOnUnderrun{};
+	PendingWrite pendingWrite{};
 public:
 	bool addSoundBuffersOnUnderrunSetting{};
 	int8_t defaultSoundBuffers{3};
@@ -108,6 +123,8 @@ public:
 	size_t framesCapacity() const;
 	bool shouldStartAudioWrites(size_t bytesToWrite = 0) const;
 	void resizeAudioBuffer(size_t targetBufferFillBytes);
+	void updateUnderrunState(IG::Audio::Format);
+	void updateStartState(IG::Audio::Format, size_t bytesWritten);
 	void updateVolume();
 	void updateAddBuffersOnUnderrun();
 };
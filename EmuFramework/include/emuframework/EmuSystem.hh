@@ -21,12 +21,14 @@
 #include <imagine/time/Time.hh>
 #include <imagine/audio/SampleFormat.hh>
 #include <imagine/util/rectangle2.h>
+#include <imagine/util/memory/Buffer.hh>
 #include <emuframework/EmuTiming.hh>
 #include <emuframework/VController.hh>
 #include <emuframework/EmuInput.hh>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace IG
 {
@@ -35,6 +37,7 @@ class PixelFormat;
 class IO;
 class FileIO;
 class MapIO;
+class IOBuffer;
 }
 
 namespace IG::Input
@@ -129,6 +132,22 @@ enum class VideoSystem: uint8_t
 
 using FrameTime = Nanoseconds;
 
+class MemoryUsageReport
+{
+public:
+	struct Entry
+	{
+		std::string_view tag;
+		size_t bytes;
+	};
+
+	std::vector<Entry> entries;
+
+	void add(std::string_view tag, size_t bytes);
+	size_t totalBytes() const;
+	std::string toString() const;
+};
+
 constexpr const char *optionUserPathContentToken = ":CONTENT:";
 
 class EmuSystem
@@ -207,6 +226,9 @@ public:
 	SystemInputDeviceDesc inputDeviceDesc(int idx) const;
 
 	// optional sub-class API functions
+	void runFrames(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *audio, int frames);
+	ByteBuffer saveStateToBuffer();
+	ByteBuffer stateFileData(ByteBuffer) const;
 	void onStart();
 	void onStop();
 	void closeSystem();
@@ -231,6 +253,8 @@ public:
 	bool shouldFastForward() const;
 	FS::FileString contentDisplayNameForPath(CStringView path) const;
 	IG::Rotation contentRotation() const;
+	void addMemoryUsage(MemoryUsageReport &) const;
+	void freeCaches();
 
 	ApplicationContext appContext() const { return appCtx; }
 	bool isActive() const { return state == State::ACTIVE; }
@@ -336,6 +360,7 @@ public:
 	void pause(EmuApp &);
 	void start(EmuApp &);
 	void closeRuntimeSystem(EmuApp &);
+	static IOBuffer contentBuffer(IO &, size_t maxSize);
 	static void throwFileReadError();
 	static void throwFileWriteError();
 	static void throwMissingContentDirError();
@@ -19,6 +19,7 @@
 #include <emuframework/EmuVideo.hh>
 #include <main/MainSystem.hh>
 #include <imagine/io/IO.hh>
+#include <imagine/util/ranges.hh>
 
 namespace EmuEx
 {
@@ -199,6 +200,23 @@ void EmuSystem::runFrame(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *a
 	static_cast<MainSystem*>(this)->runFrame(task, video, audio);
 }
 
+// runs the given number of frames, only outputting video on the last one
+void EmuSystem::runFrames(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *audio, int frames)
+{
+	if(frames <= 0)
+		return;
+	if(&MainSystem::runFrames != &EmuSystem::runFrames)
+	{
+		static_cast<MainSystem*>(this)->runFrames(task, video, audio, frames);
+		return;
+	}
+	for(auto i : iotaCount(frames - 1))
+	{
+		runFrame(task, nullptr, audio);
+	}
+	runFrame(task, video, audio);
+}
+
 void EmuSystem::loadState(EmuApp &app, CStringView uri)
 {
 	static_cast<MainSystem*>(this)->loadState(app, uri);
@@ -209,6 +227,23 @@ void EmuSystem::saveState(CStringView uri)
 	static_cast<MainSystem*>(this)->saveState(uri);
 }
 
+// serializes the state into memory, returns an empty buffer if the system can only save to a file
+ByteBuffer EmuSystem::saveStateToBuffer()
+{
+	if(&MainSystem::saveStateToBuffer != &EmuSystem::saveStateToBuffer)
+		return static_cast<MainSystem*>(this)->saveStateToBuffer();
+	return {};
+}
+
+// converts a buffer from saveStateToBuffer() into the contents of a state file (compression, headers, etc.),
+// may run on a worker thread so it must not access the emulated system
+ByteBuffer EmuSystem::stateFileData(ByteBuffer buff) const
+{
+	if(&MainSystem::stateFileData != &EmuSystem::stateFileData)
+		return static_cast<const MainSystem*>(this)->stateFileData(std::move(buff));
+	return buff;
+}
+
 void EmuSystem::clearInputBuffers(EmuInputView &view)
 {
 	static_cast<MainSystem*>(this)->clearInputBuffers(view);
@@ -265,4 +300,16 @@ void EmuSystem::onStop()
 		static_cast<MainSystem*>(this)->onStop();
 }
 
+void EmuSystem::addMemoryUsage(MemoryUsageReport &report) const
+{
+	if(&MainSystem::addMemoryUsage != &EmuSystem::addMemoryUsage)
+		static_cast<const MainSystem*>(this)->addMemoryUsage(report);
+}
+
+void EmuSystem::freeCaches()
+{
+	if(&MainSystem::freeCaches != &EmuSystem::freeCaches)
+		static_cast<MainSystem*>(this)->freeCaches();
+}
+
 }
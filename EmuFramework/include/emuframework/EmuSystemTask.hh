@@ -67,7 +67,7 @@ public:
 	void stop();
 	void runFrame(EmuVideo *, EmuAudio *, int8_t frames, bool skipForward, bool fastForward);
 	void sendVideoFormatChangedReply(EmuVideo &);
-	void sendFrameFinishedReply(EmuVideo &);
+	void sendFrameFinishedReply(EmuVideo &, uint32_t frameSerial);
 	void sendScreenshotReply(bool success);
 	auto threadId() const { return threadId_; }
 
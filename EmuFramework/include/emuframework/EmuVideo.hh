@@ -21,6 +21,7 @@
 #include <imagine/gfx/PixmapBufferTexture.hh>
 #include <imagine/gfx/SyncFence.hh>
 #include <optional>
+#include <atomic>
 
 namespace EmuEx
 {
@@ -65,7 +66,7 @@ public:
 	void startUnchangedFrame(EmuSystemTaskContext);
 	void finishFrame(EmuSystemTaskContext, Gfx::LockedTextureBuffer texBuff);
 	void finishFrame(EmuSystemTaskContext, IG::PixmapView pix);
-	void dispatchFrameFinished();
+	void dispatchFrameFinished(uint32_t serial);
 	bool addFence(Gfx::RendererCommands &cmds);
 	void clear();
 	void takeGameScreenshot();
@@ -87,6 +88,7 @@ public:
 	IG::PixelFormat internalRenderPixelFormat() const;
 	static Gfx::TextureSamplerConfig samplerConfigForLinearFilter(bool useLinearFilter);
 	void updateNeedsFence();
+	uint32_t presentedFrameSerial() const { return presentedFrameSerial_.load(std::memory_order_acquire); }
 
 protected:
 	Gfx::RendererTask *rTask{};
@@ -95,6 +97,8 @@ protected:
 	FrameFinishedDelegate onFrameFinished;
 	FormatChangedDelegate onFormatChanged;
 	IG::PixelFormat renderFmt;
+	uint32_t frameSerial{}; // counts finished frames on the emulation thread
+	std::atomic<uint32_t> presentedFrameSerial_{}; // serial of the last frame handed to the renderer
 	Gfx::TextureBufferMode bufferMode{};
 	bool screenshotNextFrame{};
 	bool singleBuffer{};
@@ -17,6 +17,7 @@
 
 #include <emuframework/VideoImageOverlay.hh>
 #include <emuframework/VideoImageEffect.hh>
+#include <emuframework/VideoFrameBlend.hh>
 #include <imagine/gfx/GfxSprite.hh>
 #include <imagine/gfx/Vec3.hh>
 #include <imagine/pixmap/PixelFormat.hh>
@@ -43,6 +44,9 @@ public:
 	void setEffectFormat(IG::PixelFormat);
 	void setLinearFilter(bool on);
 	void setBrightness(Gfx::Vec3);
+	void setFrameBlend(FrameBlendMode);
+	FrameBlendMode frameBlend() const { return userFrameBlendMode; }
+	void setSystemFrameBlend(FrameBlendMode, float phosphorPersistence);
 	void onVideoFormatChanged(IG::PixelFormat effectFmt);
 	EmuVideo &emuVideo() const { return video; }
 	Gfx::ColorSpace colorSpace() const { return colSpace; }
@@ -62,6 +66,7 @@ private:
 	IG::StaticArrayList<VideoImageEffect*, 1> effects;
 	EmuVideo &video;
 	VideoImageEffect userEffect;
+	VideoFrameBlend frameBlendEffect;
 	Gfx::Sprite disp;
 	IG::WindowRect contentRect_;
 	Gfx::Vec3 brightness{1.f, 1.f, 1.f};
@@ -74,6 +79,9 @@ public:
 private:
 	ImageEffectId userEffectId{};
 	ImageOverlayId userOverlayEffectId{};
+	FrameBlendMode userFrameBlendMode{};
+	FrameBlendMode systemFrameBlendMode{};
+	float systemPhosphorPersistence{.8f};
 	Gfx::ColorSpace colSpace{};
 	uint8_t zoom_{100};
 	IG::Rotation rotation{};
@@ -81,6 +89,7 @@ private:
 
 	void placeOverlay();
 	void updateEffectImageSize();
+	void updateFrameBlend();
 	void buildEffectChain();
 	bool updateConvertColorSpaceEffect();
 	void updateSprite();
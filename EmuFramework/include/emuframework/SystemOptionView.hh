@@ -42,6 +42,7 @@ protected:
 	MultiChoiceMenuItem fastModeSpeed;
 	TextMenuItem slowModeSpeedItem[3];
 	MultiChoiceMenuItem slowModeSpeed;
+	BoolMenuItem lowMemoryMode;
 	IG_UseMemberIf(Config::envIsAndroid, BoolMenuItem, performanceMode);
 	IG_UseMemberIf(Config::envIsAndroid && Config::DEBUG_BUILD, BoolMenuItem, noopThread);
 	IG_UseMemberIf(Config::cpuAffinity, TextMenuItem, cpuAffinity);
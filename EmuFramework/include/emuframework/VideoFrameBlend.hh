@@ -0,0 +1,60 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/gfx/Texture.hh>
+#include <imagine/gfx/Program.hh>
+#include <imagine/util/enum.hh>
+
+namespace EmuEx
+{
+
+using namespace IG;
+
+WISE_ENUM_CLASS((FrameBlendMode, uint8_t),
+	(OFF, 0),
+	(MIX, 1),
+	(PHOSPHOR, 2));
+
+// Blends each new video frame with the previous one on the GPU, used to emulate
+// flicker-based transparency (MIX) or slow CRT phosphor decay (PHOSPHOR)
+class VideoFrameBlend
+{
+public:
+	constexpr VideoFrameBlend() = default;
+	VideoFrameBlend(Gfx::Renderer &);
+	void setMode(FrameBlendMode, float phosphorPersistence);
+	void setFormat(Gfx::Renderer &, PixmapDesc, Gfx::TextureSamplerConfig);
+	void setSampler(Gfx::TextureSamplerConfig);
+	Gfx::TextureSpan draw(Gfx::RendererCommands &, Gfx::TextureSpan src, uint32_t frameId);
+	Gfx::Texture &renderTarget() { return output; }
+	constexpr FrameBlendMode mode() const { return mode_; }
+	explicit operator bool() const { return (bool)prog; }
+
+private:
+	Gfx::Texture output;
+	Gfx::Texture history;
+	Gfx::Program prog;
+	int weightU{-1};
+	uint32_t lastFrameId{};
+	float phosphorPersistence{.8f};
+	FrameBlendMode mode_{FrameBlendMode::MIX};
+	bool hasHistory{};
+
+	void drawPass(Gfx::RendererCommands &, Gfx::Texture &target, Gfx::TextureSpan src, float rgbWeight, float alpha);
+};
+
+}
@@ -31,7 +31,9 @@ WISE_ENUM_CLASS((ImageEffectId, uint8_t),
 	(SCALE2X, 2),
 	(PRESCALE2X, 3),
 	(PRESCALE3X, 4),
-	(PRESCALE4X, 5));
+	(PRESCALE4X, 5),
+	(COMPOSITE_PAL, 6),
+	(COMPOSITE_NTSC, 7));
 
 class VideoImageEffect
 {
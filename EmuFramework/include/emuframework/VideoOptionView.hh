@@ -62,12 +62,14 @@ protected:
 	MultiChoiceMenuItem contentRotation;
 	TextMenuItem placeVideo;
 	BoolMenuItem imgFilter;
-	TextMenuItem imgEffectItem[6];
+	TextMenuItem imgEffectItem[8];
 	MultiChoiceMenuItem imgEffect;
 	TextMenuItem overlayEffectItem[8];
 	MultiChoiceMenuItem overlayEffect;
 	TextMenuItem overlayEffectLevelItem[5];
 	MultiChoiceMenuItem overlayEffectLevel;
+	TextMenuItem frameBlendItem[3];
+	MultiChoiceMenuItem frameBlend;
 	TextMenuItem imgEffectPixelFormatItem[3];
 	MultiChoiceMenuItem imgEffectPixelFormat;
 	StaticArrayList<TextMenuItem, 4> windowPixelFormatItem;
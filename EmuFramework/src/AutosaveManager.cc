@@ -20,6 +20,10 @@
 #include "pathUtils.hh"
 #include <imagine/io/MapIO.hh>
 #include <imagine/io/FileIO.hh>
+#include <imagine/fs/FS.hh>
+#include <imagine/util/string.h>
+#include <imagine/util/format.hh>
+#include <utility>
 
 namespace EmuEx
 {
@@ -33,7 +37,7 @@ AutosaveManager::AutosaveManager(EmuApp &app_):
 		{
 			logMsg("running autosave timer");
 			app.syncEmulationThread();
-			save();
+			saveInBackground();
 			resetTimer();
 			return true;
 		}
@@ -43,6 +47,7 @@ bool AutosaveManager::save(AutosaveActionSource src)
 {
 	if(autoSaveSlot == noAutosaveName)
 		return true;
+	waitForStateWrite();
 	logMsg("saving autosave slot:%s", autoSaveSlot.c_str());
 	system().flushBackupMemory(app);
 	if(saveOnlyBackupMemory && src == AutosaveActionSource::Auto)
@@ -50,10 +55,96 @@ bool AutosaveManager::save(AutosaveActionSource src)
 	return app.saveState(statePath());
 }
 
+static void writeStateData(ApplicationContext ctx, std::span<const uint8_t> data, const FS::PathString &path)
+{
+	if(isUri(path))
+	{
+		if(FileUtils::writeToUri(ctx, path, data) == -1)
+			logErr("error writing autosave state:%s", path.data());
+		return;
+	}
+	// write to a temporary file first so a failed write never leaves a partial state
+	auto tempPath = FS::PathString{path}.append(".tmp");
+	if(FileUtils::writeToPath(tempPath, data) == -1 || !FS::rename(tempPath, path))
+	{
+		logErr("error writing autosave state:%s", path.data());
+		FS::remove(tempPath);
+	}
+}
+
+static void writeStateSnapshot(ApplicationContext ctx, const FS::PathString &snapshotPath, const FS::PathString &path)
+{
+	auto buff = FileUtils::bufferFromPath(snapshotPath, {}, SIZE_MAX);
+	FS::remove(snapshotPath);
+	if(!buff)
+	{
+		logErr("error reading state snapshot:%s", snapshotPath.data());
+		return;
+	}
+	writeStateData(ctx, buff.span(), path);
+}
+
+bool AutosaveManager::saveInBackground()
+{
+	if(autoSaveSlot == noAutosaveName)
+		return true;
+	if(stateWriteThread.isWorking())
+	{
+		logMsg("skipping autosave, previous state is still being written");
+		return true;
+	}
+	logMsg("saving autosave slot:%s in background", autoSaveSlot.c_str());
+	system().flushBackupMemory(app);
+	if(saveOnlyBackupMemory)
+		return true;
+	// serialize the state to memory while emulation is paused, then compress and
+	// write it to the possibly slow save location on a worker thread
+	try
+	{
+		if(auto buff = system().saveStateToBuffer(); buff)
+		{
+			stateWriteThread.reset([&sys = std::as_const(system()), ctx = appContext(), path = statePath()](WorkThread::Context, ByteBuffer buff)
+			{
+				try
+				{
+					auto data = sys.stateFileData(std::move(buff));
+					writeStateData(ctx, data.span(), path);
+				}
+				catch(std::exception &err)
+				{
+					logErr("error writing autosave state:%s", err.what());
+				}
+			}, std::move(buff));
+			return true;
+		}
+	}
+	catch(std::exception &err)
+	{
+		app.postErrorMessage(4, std::format("Can't save state:\n{}", err.what()));
+		return false;
+	}
+	// otherwise save to app-private storage first and copy the file on the worker thread
+	auto snapshotPath = FS::pathString(appContext().cachePath(), "autosave.snapshot");
+	if(!app.saveState(snapshotPath))
+		return false;
+	stateWriteThread.reset([ctx = appContext(), snapshotPath, path = statePath()](WorkThread::Context)
+	{
+		writeStateSnapshot(ctx, snapshotPath, path);
+	});
+	return true;
+}
+
+void AutosaveManager::waitForStateWrite()
+{
+	if(stateWriteThread.joinable())
+		stateWriteThread.join();
+}
+
 bool AutosaveManager::load(AutosaveActionSource src, LoadAutosaveMode mode)
 {
 	if(autoSaveSlot == noAutosaveName)
 		return true;
+	waitForStateWrite();
 	try
 	{
 		system().loadBackupMemory(app);
@@ -104,6 +195,7 @@ bool AutosaveManager::setSlot(std::string_view name)
 
 bool AutosaveManager::renameSlot(std::string_view name, std::string_view newName)
 {
+	waitForStateWrite();
 	if(!appContext().renameFileUri(system().contentLocalSaveDirectory(name),
 		system().contentLocalSaveDirectory(newName)))
 	{
@@ -118,6 +210,7 @@ bool AutosaveManager::deleteSlot(std::string_view name)
 {
 	if(name == autoSaveSlot)
 		return false;
+	waitForStateWrite();
 	auto ctx = appContext();
 	if(!ctx.forEachInDirectoryUri(system().contentLocalSaveDirectory(name),
 			[this, ctx](const FS::directory_entry &e)
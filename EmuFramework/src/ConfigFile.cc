@@ -105,6 +105,8 @@ void EmuApp::saveConfigFile(FileIO &io)
 	writeOptionValue(io, CFGKEY_VIDEO_COLOR_SPACE, windowDrawableColorSpaceOption());
 	writeOptionValue(io, CFGKEY_RENDER_PIXEL_FORMAT, renderPixelFormatOption());
 	writeOptionValueIfNotDefault(io, CFGKEY_SHOW_HIDDEN_FILES, showHiddenFilesInPicker, false);
+	writeOptionValueIfNotDefault(io, CFGKEY_LOW_MEMORY_MODE, lowMemoryMode, false);
+	writeOptionValueIfNotDefault(io, CFGKEY_FRAME_BLEND, videoLayer().frameBlend(), FrameBlendMode::OFF);
 	if constexpr(MOGA_INPUT)
 	{
 		if(mogaManagerPtr)
@@ -286,6 +288,9 @@ EmuApp::ConfigParams EmuApp::loadConfigFile(IG::ApplicationContext ctx)
 				case CFGKEY_WINDOW_PIXEL_FORMAT: return readOptionValue(io, size, pendingWindowDrawableConf.pixelFormat, windowPixelFormatIsValid);
 				case CFGKEY_VIDEO_COLOR_SPACE: return readOptionValue(io, size, pendingWindowDrawableConf.colorSpace, colorSpaceIsValid);
 				case CFGKEY_SHOW_HIDDEN_FILES: return readOptionValue(io, size, showHiddenFilesInPicker);
+				case CFGKEY_LOW_MEMORY_MODE: return readOptionValue(io, size, lowMemoryMode);
+				case CFGKEY_FRAME_BLEND: return readOptionValue<FrameBlendMode>(io, size,
+					[&](auto m){ videoLayer().setFrameBlend(m); }, [](auto m){ return m <= lastEnum<FrameBlendMode>; });
 				case CFGKEY_OVERRIDE_SCREEN_FRAME_RATE: return readOptionValue(io, size, overrideScreenFrameRate);
 				case CFGKEY_BLANK_FRAME_INSERTION: return readOptionValue(io, size, allowBlankFrameInsertion);
 				case CFGKEY_CONTENT_ROTATION: return readOptionValue(io, size, contentRotation_, [](auto r){return r <= lastEnum<Rotation>;});
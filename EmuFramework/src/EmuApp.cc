@@ -734,6 +734,8 @@ void EmuApp::mainInitCommon(IG::ApplicationInitParams initParams, IG::Applicatio
 					{
 						viewManager.defaultFace.freeCaches();
 						viewManager.defaultBoldFace.freeCaches();
+						if(lowMemoryMode && !system().isActive())
+							freeEmulationCaches();
 						if(e.running)
 							viewController().prepareDraw();
 					},
@@ -949,6 +951,26 @@ void EmuApp::pauseEmulation()
 	emuVideoLayer.setBrightness(videoBrightnessRGB * pausedVideoBrightnessScale);
 	viewController().emuWindow().setDrawEventPriority();
 	removeOnFrame();
+	if(lowMemoryMode)
+		freeEmulationCaches();
+}
+
+MemoryUsageReport EmuApp::memoryUsage()
+{
+	MemoryUsageReport report;
+	report.add("Audio Buffer", audio().format().framesToBytes(audio().framesCapacity()));
+	if(auto &img = video().image(); img)
+		report.add("Video Frame", img.pixmapDesc().bytes());
+	if(system().hasContent())
+		system().addMemoryUsage(report);
+	return report;
+}
+
+void EmuApp::freeEmulationCaches()
+{
+	audio().freeBuffer();
+	if(system().hasContent())
+		system().freeCaches();
 }
 
 bool EmuApp::hasArchiveExtension(std::string_view name)
@@ -1538,22 +1560,19 @@ void EmuApp::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *
 			// restore normal speed when skip ends
 			system().setSpeedMultiplier(*audio, 1.);
 		}
+		system().runFrame(taskCtx, video, audio);
 	}
 	else
 	{
-		skipFrames(taskCtx, frames - 1, audio);
+		system().runFrames(taskCtx, video, audio, frames);
 	}
-	system().runFrame(taskCtx, video, audio);
 	system().updateBackupMemoryCounter();
 }
 
 void EmuApp::skipFrames(EmuSystemTaskContext taskCtx, int frames, EmuAudio *audio)
 {
 	assert(system().hasContent());
-	for(auto i : iotaCount(frames))
-	{
-		system().runFrame(taskCtx, nullptr, audio);
-	}
+	system().runFrames(taskCtx, nullptr, audio, frames);
 }
 
 bool EmuApp::skipForwardFrames(EmuSystemTaskContext taskCtx, int frames)
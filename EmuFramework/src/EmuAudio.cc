@@ -253,6 +253,18 @@ void EmuAudio::close()
 	stop();
 	audioStream.reset();
 	rBuff = {};
+	pendingWrite = PendingWrite::NONE;
+}
+
+void EmuAudio::freeBuffer()
+{
+	if(audioStream && audioStream.isOpen())
+		return;
+	// buffer is re-created in start()
+	rBuff = {};
+	scratchBuff.reset();
+	scratchBuffSize = 0;
+	pendingWrite = PendingWrite::NONE;
 }
 
 void EmuAudio::flush()
@@ -266,12 +278,8 @@ void EmuAudio::flush()
 	rBuff.clear();
 }
 
-void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
+void EmuAudio::updateUnderrunState(IG::Audio::Format inputFormat)
 {
-	if(!framesToWrite) [[unlikely]]
-		return;
-	assumeExpr(rBuff);
-	auto inputFormat = format();
 	switch(audioWriteState)
 	{
 		case AudioWriteState::MULTI_UNDERRUN:
@@ -289,6 +297,30 @@ void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
 		default:
 		break;
 	}
+}
+
+void EmuAudio::updateStartState(IG::Audio::Format inputFormat, size_t bytesWritten)
+{
+	if(audioWriteState == AudioWriteState::BUFFER && shouldStartAudioWrites(bytesWritten))
+	{
+		if(Config::DEBUG_BUILD)
+		{
+			auto bytes = rBuff.size();
+			auto capacity = rBuff.capacity();
+			logMsg("starting audio writes with buffer fill %zu/%zu bytes %.2f/%.2f secs",
+				bytes, capacity, inputFormat.bytesToTime(bytes).count(), inputFormat.bytesToTime(capacity).count());
+		}
+		audioWriteState = AudioWriteState::ACTIVE;
+	}
+}
+
+void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
+{
+	if(!framesToWrite) [[unlikely]]
+		return;
+	assumeExpr(rBuff);
+	auto inputFormat = format();
+	updateUnderrunState(inputFormat);
 	const size_t sampleFrames = framesToWrite;
 	if(speedMultiplier != 1.) [[unlikely]]
 	{
@@ -317,17 +349,48 @@ void EmuAudio::writeFrames(const void *samples, size_t framesToWrite)
 		simpleResample(rBuff.writeAddr(), freeFrames, samples, sampleFrames, inputFormat);
 		rBuff.commitWrite(freeBytes);
 	}
-	if(audioWriteState == AudioWriteState::BUFFER && shouldStartAudioWrites(bytes))
+	updateStartState(inputFormat, bytes);
+}
+
+void *EmuAudio::frameWriteBuffer(size_t maxFrames)
+{
+	assumeExpr(rBuff);
+	auto inputFormat = format();
+	updateUnderrunState(inputFormat);
+	auto bytes = inputFormat.framesToBytes(maxFrames);
+	if(speedMultiplier == 1. && bytes <= rBuff.freeSpace()) [[likely]]
 	{
-		if(Config::DEBUG_BUILD)
-		{
-			auto bytes = rBuff.size();
-			auto capacity = rBuff.capacity();
-			logMsg("starting audio writes with buffer fill %zu/%zu bytes %.2f/%.2f secs",
-				bytes, capacity, inputFormat.bytesToTime(bytes).count(), inputFormat.bytesToTime(capacity).count());
-		}
-		audioWriteState = AudioWriteState::ACTIVE;
+		// the buffer's memory is mirrored so the free space is always contiguous
+		pendingWrite = PendingWrite::RING_BUFFER;
+		return rBuff.writeAddr();
+	}
+	// frames need resampling or may overrun, pass them through writeFrames() on commit
+	pendingWrite = PendingWrite::SCRATCH;
+	if(scratchBuffSize < bytes)
+	{
+		scratchBuff = std::make_unique_for_overwrite<char[]>(bytes);
+		scratchBuffSize = bytes;
 	}
+	return scratchBuff.get();
+}
+
+void EmuAudio::commitFrames(size_t frames)
+{
+	auto pending = std::exchange(pendingWrite, PendingWrite::NONE);
+	assert(pending != PendingWrite::NONE);
+	if(pending == PendingWrite::NONE) [[unlikely]]
+		return;
+	if(pending == PendingWrite::SCRATCH)
+	{
+		writeFrames(scratchBuff.get(), frames);
+		return;
+	}
+	if(!frames) [[unlikely]]
+		return;
+	auto inputFormat = format();
+	auto bytes = inputFormat.framesToBytes(frames);
+	rBuff.commitWrite(bytes);
+	updateStartState(inputFormat, bytes);
 }
 
 void EmuAudio::setRate(int newRate)
@@ -77,6 +77,7 @@ enum { CFGKEY_SOUND = 0, CFGKEY_TOUCH_CONTROL_DISPLAY = 1,
 	CFGKEY_VCONTROLLER_DEVICE_BUTTONS_V2 = 112, CFGKEY_VCONTROLLER_UI_BUTTONS_V2 = 113,
 	CFGKEY_INPUT_KEY_CONFIGS_V2 = 114, CFGKEY_VCONTROLLER_HIGHLIGHT_PUSHED_BUTTONS = 115,
 	CFGKEY_RECENT_CONTENT_V2 = 116, CFGKEY_MAX_RECENT_CONTENT = 117,
+	CFGKEY_LOW_MEMORY_MODE = 118, CFGKEY_FRAME_BLEND = 119,
 	// 256+ is reserved
 };
 
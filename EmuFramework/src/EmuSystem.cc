@@ -30,6 +30,7 @@
 #include <imagine/util/string.h>
 #include <algorithm>
 #include <cstring>
+#include <format>
 #include "pathUtils.hh"
 
 namespace EmuEx
@@ -395,6 +396,19 @@ void EmuSystem::loadContentFromFile(IO file, CStringView path, std::string_view
 	}
 }
 
+IOBuffer EmuSystem::contentBuffer(IO &io, size_t maxSize)
+{
+	auto size = io.size();
+	if(size > maxSize)
+		throw std::runtime_error{std::format("Content size of {} bytes exceeds the maximum of {}", size, maxSize)};
+	// plain files are memory-mapped, other sources like archive entries are read into a new buffer
+	auto buff = io.buffer(IOBufferMode::Release);
+	if(!buff)
+		throwFileReadError();
+	logMsg("%s %zu bytes of content", buff.isMappedFile() ? "mapped" : "read", buff.size());
+	return buff;
+}
+
 void EmuSystem::throwFileReadError()
 {
 	throw std::runtime_error("Error reading file");
@@ -410,6 +424,31 @@ void EmuSystem::throwMissingContentDirError()
 	throw std::runtime_error("This content must be opened with a folder, \"Browse For File\" isn't supported");
 }
 
+void MemoryUsageReport::add(std::string_view tag, size_t bytes)
+{
+	if(!bytes)
+		return;
+	entries.emplace_back(tag, bytes);
+}
+
+size_t MemoryUsageReport::totalBytes() const
+{
+	size_t total{};
+	for(const auto &e : entries) { total += e.bytes; }
+	return total;
+}
+
+std::string MemoryUsageReport::toString() const
+{
+	std::string str;
+	for(const auto &e : entries)
+	{
+		str += std::format("{}: {:.1f} KiB\n", e.tag, e.bytes / 1024.);
+	}
+	str += std::format("Total: {:.2f} MiB", totalBytes() / (1024. * 1024.));
+	return str;
+}
+
 FS::PathString EmuSystem::contentDirectory(std::string_view name) const
 {
 	return FS::uriString(contentDirectory(), name);
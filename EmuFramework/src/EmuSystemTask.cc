@@ -127,9 +127,9 @@ void EmuSystemTask::sendVideoFormatChangedReply(EmuVideo &video)
 	});
 }
 
-void EmuSystemTask::sendFrameFinishedReply(EmuVideo &video)
+void EmuSystemTask::sendFrameFinishedReply(EmuVideo &video, uint32_t frameSerial)
 {
-	video.dispatchFrameFinished();
+	video.dispatchFrameFinished(frameSerial);
 }
 
 void EmuSystemTask::sendScreenshotReply(bool success)
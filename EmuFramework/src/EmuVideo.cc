@@ -147,9 +147,10 @@ void EmuVideo::startUnchangedFrame(EmuSystemTaskContext taskCtx)
 	postFrameFinished(taskCtx);
 }
 
-void EmuVideo::dispatchFrameFinished()
+void EmuVideo::dispatchFrameFinished(uint32_t serial)
 {
 	//log.debug("frame finished");
+	presentedFrameSerial_.store(serial, std::memory_order_release);
 	onFrameFinished(*this);
 }
 
@@ -157,7 +158,11 @@ void EmuVideo::postFrameFinished(EmuSystemTaskContext taskCtx)
 {
 	if(taskCtx)
 	{
-		taskCtx.task().sendFrameFinishedReply(*this);
+		taskCtx.task().sendFrameFinishedReply(*this, frameSerial);
+	}
+	else
+	{
+		presentedFrameSerial_.store(frameSerial, std::memory_order_release);
 	}
 }
 
@@ -169,6 +174,7 @@ void EmuVideo::finishFrame(EmuSystemTaskContext taskCtx, Gfx::LockedTextureBuffe
 	}
 	app().record(FrameTimeStatEvent::aboutToSubmitFrame);
 	vidImg.unlock(texBuff);
+	frameSerial++;
 	postFrameFinished(taskCtx);
 }
 
@@ -181,6 +187,7 @@ void EmuVideo::finishFrame(EmuSystemTaskContext taskCtx, IG::PixmapView pix)
 	app().record(FrameTimeStatEvent::aboutToSubmitFrame);
 	syncImageAccess();
 	vidImg.write(pix, {.async = true});
+	frameSerial++;
 	postFrameFinished(taskCtx);
 }
 
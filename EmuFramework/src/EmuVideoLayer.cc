@@ -150,10 +150,12 @@ void EmuVideoLayer::draw(Gfx::RendererCommands &cmds)
 	auto c = srgbOutput ? brightnessSrgb : brightness;
 	cmds.setColor({c.r, c.g, c.b});
 	cmds.set(BlendMode::OFF);
-	if(effects.size())
+	if(effects.size() || frameBlendEffect)
 	{
 		cmds.setDither(false);
 		TextureSpan srcTex = video.image();
+		if(frameBlendEffect)
+			srcTex = frameBlendEffect.draw(cmds, srcTex, video.presentedFrameSerial());
 		for(auto &ePtr : effects)
 		{
 			auto &e = *ePtr;
@@ -190,6 +192,7 @@ void EmuVideoLayer::setFormat(EmuSystem &sys, IG::PixelFormat videoFmt, IG::Pixe
 	if(!video.setRenderPixelFormat(sys, videoFmt, videoColorSpace(videoFmt)))
 	{
 		setEffectFormat(effectFmt);
+		updateFrameBlend();
 		updateConvertColorSpaceEffect();
 		updateSprite();
 		setOverlay(userOverlayEffectId);
@@ -244,6 +247,8 @@ void EmuVideoLayer::setLinearFilter(bool on)
 	useLinearFilter = on;
 	if(effects.size())
 		effects.back()->setSampler(samplerConfig());
+	else if(frameBlendEffect)
+		frameBlendEffect.setSampler(samplerConfig());
 	else
 		video.setSampler(samplerConfig());
 }
@@ -254,9 +259,27 @@ void EmuVideoLayer::setBrightness(Gfx::Vec3 b)
 	brightnessSrgb = glm::convertSRGBToLinear(b);
 }
 
+void EmuVideoLayer::setFrameBlend(FrameBlendMode mode)
+{
+	userFrameBlendMode = mode;
+	updateFrameBlend();
+	if(video.image())
+		updateSprite();
+}
+
+void EmuVideoLayer::setSystemFrameBlend(FrameBlendMode mode, float phosphorPersistence)
+{
+	systemFrameBlendMode = mode;
+	systemPhosphorPersistence = phosphorPersistence;
+	updateFrameBlend();
+	if(video.image())
+		updateSprite();
+}
+
 void EmuVideoLayer::onVideoFormatChanged(IG::PixelFormat effectFmt)
 {
 	setEffectFormat(effectFmt);
+	updateFrameBlend();
 	if(!updateConvertColorSpaceEffect())
 	{
 		updateEffectImageSize();
@@ -295,6 +318,38 @@ void EmuVideoLayer::updateEffectImageSize()
 	}
 }
 
+void EmuVideoLayer::updateFrameBlend()
+{
+	// user setting overrides any mode requested by the system, like Stella's per-game phosphor property
+	auto mode = userFrameBlendMode != FrameBlendMode::OFF ? userFrameBlendMode : systemFrameBlendMode;
+	if(mode == FrameBlendMode::OFF || !video.image())
+	{
+		if(frameBlendEffect)
+			logMsg("deleted frame blend effect");
+		frameBlendEffect = {};
+		return;
+	}
+	auto &r = renderer();
+	if(mode == FrameBlendMode::PHOSPHOR && !r.supportsBlendMinMax())
+	{
+		logWarn("GPU lacks max blend equation, using mix for phosphor effect");
+		mode = FrameBlendMode::MIX;
+	}
+	if(!frameBlendEffect)
+	{
+		frameBlendEffect = {r};
+		if(!frameBlendEffect)
+			return;
+		logMsg("made frame blend effect");
+	}
+	frameBlendEffect.setMode(mode, systemPhosphorPersistence);
+	auto desc = video.image().pixmapDesc();
+	// store as linear RGBA if the video image is sRGB so the blended result needs no extra conversion
+	if(video.colorSpace() == Gfx::ColorSpace::SRGB)
+		desc.format = IG::PIXEL_RGBA8888;
+	frameBlendEffect.setFormat(r, desc, effects.size() ? Gfx::SamplerConfigs::noLinearNoMipClamp : samplerConfig());
+}
+
 void EmuVideoLayer::buildEffectChain()
 {
 	effects.clear();
@@ -303,6 +358,8 @@ void EmuVideoLayer::buildEffectChain()
 		effects.emplace_back(&userEffect);
 	}
 	updateEffectImageSize();
+	if(frameBlendEffect)
+		frameBlendEffect.setSampler(effects.size() ? Gfx::SamplerConfigs::noLinearNoMipClamp : samplerConfig());
 	updateSprite();
 	logOutputFormat();
 }
@@ -336,6 +393,11 @@ void EmuVideoLayer::updateSprite()
 		disp.set(effects.back()->renderTarget(), rotation);
 		video.setSampler(Gfx::SamplerConfigs::noLinearNoMipClamp);
 	}
+	else if(frameBlendEffect)
+	{
+		disp.set(frameBlendEffect.renderTarget(), rotation);
+		video.setSampler(Gfx::SamplerConfigs::noLinearNoMipClamp);
+	}
 	else
 	{
 		disp.set(video.image(), rotation);
@@ -349,6 +411,11 @@ void EmuVideoLayer::logOutputFormat()
 	{
 		IG::StaticString<255> str{"output format: main video:"};
 		str += video.image().pixmapDesc().format.name();
+		if(frameBlendEffect)
+		{
+			str += " -> frame blend:";
+			str += frameBlendEffect.renderTarget().pixmapDesc().format.name();
+		}
 		for(auto &ePtr : effects)
 		{
 			auto &e = *ePtr;
@@ -0,0 +1,148 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "VideoFrameBlend"
+#include <emuframework/VideoFrameBlend.hh>
+#include <imagine/gfx/Renderer.hh>
+#include <imagine/gfx/RendererCommands.hh>
+#include <imagine/gfx/GfxSprite.hh>
+#include <imagine/base/Error.hh>
+#include <imagine/base/Viewport.hh>
+#include <imagine/util/ScopeGuard.hh>
+#include <imagine/logger/logger.h>
+
+namespace EmuEx
+{
+
+constexpr std::string_view vShaderSrc =
+	"#define POS pos\n"
+	"in vec4 pos;\n"
+	"in vec2 texUV;\n"
+	"out vec2 texUVOut;\n"
+	"void main()\n"
+	"{\n"
+	"	texUVOut = texUV;\n"
+	"	gl_Position = POS;\n"
+	"}\n";
+
+// scales the color by weight.rgb and outputs weight.a as alpha since emulated
+// frames don't always have a valid alpha channel
+constexpr std::string_view fShaderSrc =
+	"#define TEXTURE texture\n"
+	"uniform sampler2D TEX;\n"
+	"uniform lowp vec4 weight;\n"
+	"in lowp vec2 texUVOut;\n"
+	"void main()\n"
+	"{\n"
+	"	lowp vec4 c = TEXTURE(TEX, texUVOut);\n"
+	"	FRAGCOLOR = vec4(c.rgb * weight.rgb, weight.a);\n"
+	"}\n";
+
+VideoFrameBlend::VideoFrameBlend(Gfx::Renderer &r)
+{
+	auto releaseShaderCompiler = IG::scopeGuard([&](){ r.autoReleaseShaderCompiler(); });
+	auto vShader = r.makeCompatShader(vShaderSrc, Gfx::ShaderType::VERTEX);
+	auto fShader = r.makeCompatShader(fShaderSrc, Gfx::ShaderType::FRAGMENT);
+	if(!vShader || !fShader)
+	{
+		logErr("GPU rejected frame blend shader");
+		return;
+	}
+	Gfx::UniformLocationDesc uniformDescs[]{{"weight", &weightU}};
+	prog = {r.task(), vShader, fShader, {.hasTexture = true}, uniformDescs};
+	if(!prog)
+	{
+		logErr("GPU rejected frame blend program");
+	}
+}
+
+void VideoFrameBlend::setMode(FrameBlendMode mode, float persistence)
+{
+	if(mode_ == mode && phosphorPersistence == persistence)
+		return;
+	mode_ = mode;
+	phosphorPersistence = persistence;
+	hasHistory = false;
+}
+
+void VideoFrameBlend::setFormat(Gfx::Renderer &r, PixmapDesc desc, Gfx::TextureSamplerConfig samplerConf)
+{
+	if(output && output.pixmapDesc() == desc)
+	{
+		setSampler(samplerConf);
+		return;
+	}
+	if(!output)
+	{
+		output = r.makeTexture({desc, samplerConf});
+		history = r.makeTexture({desc, Gfx::SamplerConfigs::noLinearNoMipClamp});
+	}
+	else
+	{
+		output.setFormat(desc, 1, {}, samplerConf);
+		history.setFormat(desc, 1, {}, Gfx::SamplerConfigs::noLinearNoMipClamp);
+	}
+	hasHistory = false;
+}
+
+void VideoFrameBlend::setSampler(Gfx::TextureSamplerConfig samplerConf)
+{
+	output.setSampler(samplerConf);
+}
+
+void VideoFrameBlend::drawPass(Gfx::RendererCommands &cmds, Gfx::Texture &target, Gfx::TextureSpan src, float rgbWeight, float alpha)
+{
+	cmds.setRenderTarget(target);
+	cmds.setViewport(target.pixmapDesc().size);
+	cmds.uniform(weightU, rgbWeight, rgbWeight, rgbWeight, alpha);
+	Gfx::Sprite spr{{{-1, -1}, {1, 1}}, {src.texturePtr, {{}, {1.f, 1.f}}}};
+	spr.draw(cmds);
+}
+
+Gfx::TextureSpan VideoFrameBlend::draw(Gfx::RendererCommands &cmds, Gfx::TextureSpan src, uint32_t frameId)
+{
+	using namespace IG::Gfx;
+	// redraws of the same frame (menus, window resizes) reuse the last result
+	if(hasHistory && frameId == lastFrameId)
+		return output;
+	lastFrameId = frameId;
+	cmds.setProgram(prog);
+	cmds.set(BlendMode::OFF);
+	if(!hasHistory)
+	{
+		drawPass(cmds, history, src, 1.f, 1.f);
+		hasHistory = true;
+	}
+	if(mode_ == FrameBlendMode::PHOSPHOR)
+	{
+		// max(current, previous * persistence), same as Stella's phosphor palette
+		drawPass(cmds, output, history, phosphorPersistence, 1.f);
+		cmds.setBlendEquation(BlendEquation::MAX);
+		cmds.setBlend(true);
+		drawPass(cmds, output, src, 1.f, 1.f);
+		cmds.setBlendEquation(BlendEquation::ADD);
+	}
+	else
+	{
+		drawPass(cmds, output, history, 1.f, 1.f);
+		cmds.set(BlendMode::ALPHA);
+		drawPass(cmds, output, src, 1.f, .5f);
+	}
+	cmds.set(BlendMode::OFF);
+	drawPass(cmds, history, src, 1.f, 1.f);
+	return output;
+}
+
+}
@@ -37,6 +37,9 @@ constexpr VideoImageEffect::EffectDesc prescale2xDesc{"direct-v.txt", "direct-f.
 constexpr VideoImageEffect::EffectDesc prescale3xDesc{"direct-v.txt", "direct-f.txt", {3, 3}};
 constexpr VideoImageEffect::EffectDesc prescale4xDesc{"direct-v.txt", "direct-f.txt", {4, 4}};
 
+constexpr VideoImageEffect::EffectDesc compositePALDesc{"direct-v.txt", "composite-pal-f.txt", {1, 1}};
+constexpr VideoImageEffect::EffectDesc compositeNTSCDesc{"direct-v.txt", "composite-ntsc-f.txt", {1, 1}};
+
 static constexpr const char *effectName(ImageEffectId id)
 {
 	switch(id)
@@ -47,6 +50,8 @@ static constexpr const char *effectName(ImageEffectId id)
 		case ImageEffectId::PRESCALE2X: return "Prescale 2X";
 		case ImageEffectId::PRESCALE3X: return "Prescale 3X";
 		case ImageEffectId::PRESCALE4X: return "Prescale 4X";
+		case ImageEffectId::COMPOSITE_PAL: return "Composite PAL";
+		case ImageEffectId::COMPOSITE_NTSC: return "Composite NTSC";
 	}
 	return nullptr;
 }
@@ -61,6 +66,8 @@ static constexpr VideoImageEffect::EffectDesc effectDesc(ImageEffectId id)
 		case ImageEffectId::PRESCALE2X: return prescale2xDesc;
 		case ImageEffectId::PRESCALE3X: return prescale3xDesc;
 		case ImageEffectId::PRESCALE4X: return prescale4xDesc;
+		case ImageEffectId::COMPOSITE_PAL: return compositePALDesc;
+		case ImageEffectId::COMPOSITE_NTSC: return compositeNTSCDesc;
 	}
 	return {};
 }
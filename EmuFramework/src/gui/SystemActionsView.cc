@@ -235,6 +235,16 @@ SystemActionsView::SystemActionsView(ViewAttachParams attach, bool customMenu):
 				}), e);
 		}
 	},
+	memoryUsage
+	{
+		"Memory Usage", &defaultFace(),
+		[this]
+		{
+			auto report = app().memoryUsage().toString();
+			logMsg("memory usage:\n%s", report.c_str());
+			app().postMessage(6, false, report);
+		}
+	},
 	close
 	{
 		"Close Content", &defaultFace(),
@@ -283,6 +293,7 @@ void SystemActionsView::loadStandardItems()
 		item.emplace_back(&addLauncherIcon);
 	item.emplace_back(&screenshot);
 	item.emplace_back(&resetSessionOptions);
+	item.emplace_back(&memoryUsage);
 	item.emplace_back(&close);
 }
 
@@ -163,6 +163,15 @@ SystemOptionView::SystemOptionView(ViewAttachParams attach, bool customMenu):
 		(MenuItem::Id)app().altSpeed(AltSpeedMode::slow),
 		slowModeSpeedItem
 	},
+	lowMemoryMode
+	{
+		"Free Caches When Paused", &defaultFace(),
+		app().lowMemoryMode,
+		[this](BoolMenuItem &item)
+		{
+			app().lowMemoryMode = item.flipBoolValue(*this);
+		}
+	},
 	performanceMode
 	{
 		"Performance Mode", &defaultFace(),
@@ -205,6 +214,7 @@ void SystemOptionView::loadStockItems()
 	item.emplace_back(&confirmOverwriteState);
 	item.emplace_back(&fastModeSpeed);
 	item.emplace_back(&slowModeSpeed);
+	item.emplace_back(&lowMemoryMode);
 	if(used(performanceMode) && appContext().hasSustainedPerformanceMode())
 		item.emplace_back(&performanceMode);
 	if(used(noopThread))
@@ -535,6 +535,8 @@ VideoOptionView::VideoOptionView(ViewAttachParams attach, bool customMenu):
 		{"Prescale 2x", &defaultFace(), std::to_underlying(ImageEffectId::PRESCALE2X)},
 		{"Prescale 3x", &defaultFace(), std::to_underlying(ImageEffectId::PRESCALE3X)},
 		{"Prescale 4x", &defaultFace(), std::to_underlying(ImageEffectId::PRESCALE4X)},
+		{"Composite (PAL)", &defaultFace(), std::to_underlying(ImageEffectId::COMPOSITE_PAL)},
+		{"Composite (NTSC)", &defaultFace(), std::to_underlying(ImageEffectId::COMPOSITE_NTSC)},
 	},
 	imgEffect
 	{
@@ -613,6 +615,25 @@ VideoOptionView::VideoOptionView(ViewAttachParams attach, bool customMenu):
 		(MenuItem::Id)app().overlayEffectLevel(),
 		overlayEffectLevelItem
 	},
+	frameBlendItem
+	{
+		{"Off",      &defaultFace(), std::to_underlying(FrameBlendMode::OFF)},
+		{"Mix",      &defaultFace(), std::to_underlying(FrameBlendMode::MIX)},
+		{"Phosphor", &defaultFace(), std::to_underlying(FrameBlendMode::PHOSPHOR)},
+	},
+	frameBlend
+	{
+		"Frame Blending", &defaultFace(),
+		{
+			.defaultItemOnSelect = [this](TextMenuItem &item)
+			{
+				videoLayer->setFrameBlend(FrameBlendMode(item.id()));
+				app().viewController().postDrawToEmuWindows();
+			}
+		},
+		(MenuItem::Id)app().videoLayer().frameBlend(),
+		frameBlendItem
+	},
 	imgEffectPixelFormatItem
 	{
 		{"Auto (Match display format)", &defaultFace(), PIXEL_NONE},
@@ -916,6 +937,7 @@ void VideoOptionView::loadStockItems()
 	item.emplace_back(&imgEffect);
 	item.emplace_back(&overlayEffect);
 	item.emplace_back(&overlayEffectLevel);
+	item.emplace_back(&frameBlend);
 	item.emplace_back(&screenShapeHeading);
 	item.emplace_back(&zoom);
 	item.emplace_back(&viewportZoom);
@@ -18,14 +18,21 @@
 #include <imagine/gui/MenuItem.hh>
 #include <imagine/util/format.hh>
 #include <imagine/util/string.h>
+#include <imagine/util/ranges.hh>
 #include <emuframework/EmuApp.hh>
 #include <mednafen/types.h>
 #include <mednafen/video/surface.h>
 #include <mednafen/hash/md5.h>
 #include <mednafen/git.h>
+#include <mednafen/FileStream.h>
 #include <mednafen/MemoryStream.h>
+#include <mednafen/state.h>
+#include <zlib.h>
+#include <cstring>
 #include <main/MainSystem.hh>
 #include <string_view>
+#include <algorithm>
+#include <stdexcept>
 
 namespace EmuEx
 {
@@ -97,44 +104,81 @@ inline BoolMenuItem saveFilenameTypeMenuItem(auto &view, auto &system)
 inline void loadContent(EmuSystem &sys, Mednafen::MDFNGI &mdfnGameInfo, IO &io, size_t maxContentSize)
 {
 	using namespace Mednafen;
-	auto stream = std::make_unique<MemoryStream>(maxContentSize, true);
-	auto size = io.read(stream->map(), stream->map_size());
-	if(size <= 0)
-		sys.throwFileReadError();
-	stream->setSize(size);
-	MDFNFILE fp(&NVFS, std::move(stream));
+	MDFNFILE fp(&NVFS, std::make_unique<FileStream>(MapIO{sys.contentBuffer(io, maxContentSize)}));
 	GameFile gf{&NVFS, std::string{sys.contentDirectory()}, fp.stream(),
 		std::string{withoutDotExtension(sys.contentFileName())},
 		std::string{sys.contentName()}};
 	mdfnGameInfo.Load(&gf);
 }
 
-inline void runFrame(EmuSystem &sys, Mednafen::MDFNGI &mdfnGameInfo, EmuSystemTaskContext taskCtx,
-	EmuVideo *videoPtr, MutablePixmapView pixView, EmuAudio *audioPtr, size_t maxAudioFrames, size_t maxLineWidths = 0)
+// runs the given number of frames with video output only on the last one,
+// audio from all frames is written to a single buffer and committed once
+inline void runFrames(EmuSystem &sys, Mednafen::MDFNGI &mdfnGameInfo, EmuSystemTaskContext taskCtx,
+	EmuVideo *videoPtr, MutablePixmapView pixView, EmuAudio *audioPtr, size_t maxAudioFrames, int frames, size_t maxLineWidths = 0)
 {
 	using namespace Mednafen;
-	int16 audioBuff[maxAudioFrames * 2];
-	EmulateSpecStruct espec{};
-	if(audioPtr)
-	{
-		espec.SoundBuf = audioBuff;
-		espec.SoundBufMaxSize = maxAudioFrames;
-	}
-	espec.taskCtx = taskCtx;
-	espec.sys = &sys;
-	espec.video = videoPtr;
-	espec.skip = !videoPtr;
+	auto soundBuf = audioPtr ? (char*)audioPtr->frameWriteBuffer(maxAudioFrames * frames) : nullptr;
+	size_t soundBufFrames{};
 	auto mSurface = toMDFNSurface(pixView);
-	espec.surface = &mSurface;
 	int32 lineWidth[maxLineWidths ?: 1];
-	if(maxLineWidths)
-		espec.LineWidths = lineWidth;
-	mdfnGameInfo.Emulate(&espec);
+	for(auto i : iotaCount(frames))
+	{
+		EmulateSpecStruct espec{};
+		if(soundBuf)
+		{
+			espec.SoundBuf = (int16*)(soundBuf + audioPtr->format().framesToBytes(soundBufFrames));
+			espec.SoundBufMaxSize = maxAudioFrames;
+		}
+		espec.taskCtx = taskCtx;
+		espec.sys = &sys;
+		espec.video = i == frames - 1 ? videoPtr : nullptr;
+		espec.skip = !espec.video;
+		espec.surface = &mSurface;
+		if(maxLineWidths)
+			espec.LineWidths = lineWidth;
+		mdfnGameInfo.Emulate(&espec);
+		assert((size_t)espec.SoundBufSize <= maxAudioFrames);
+		soundBufFrames += espec.SoundBufSize;
+	}
 	if(audioPtr)
 	{
-		assert((unsigned)espec.SoundBufSize <= audioPtr->format().bytesToFrames(sizeof(audioBuff)));
-		audioPtr->writeFrames((uint8_t*)audioBuff, espec.SoundBufSize);
+		audioPtr->commitFrames(soundBufFrames);
 	}
 }
 
+// Same state data as MDFNI_SaveState() without the file write and compression,
+// those happen in stateFileDataMDFN() so they can run off the emulation thread
+inline ByteBuffer saveStateToBufferMDFN()
+{
+	using namespace Mednafen;
+	MemoryStream st(65536);
+	MDFNSS_SaveSM(&st, false);
+	ByteBuffer buff{size_t(st.size())};
+	std::memcpy(buff.data(), st.map(), buff.size());
+	return buff;
+}
+
+// gzip compresses a state buffer using the filesys.state_comp_level setting like GZFileStream,
+// a negative level writes it uncompressed which GZFileStream also reads transparently
+inline ByteBuffer stateFileDataMDFN(ByteBuffer buff)
+{
+	auto level = Mednafen::MDFN_GetSettingI("filesys.state_comp_level");
+	if(level < 0)
+		return buff;
+	z_stream zs{};
+	if(deflateInit2(&zs, std::min(int(level), 9), Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		throw std::runtime_error{"zlib init error"};
+	auto outSize = deflateBound(&zs, buff.size());
+	std::unique_ptr<uint8_t[]> out{new uint8_t[outSize]};
+	zs.next_in = buff.data();
+	zs.avail_in = buff.size();
+	zs.next_out = out.get();
+	zs.avail_out = outSize;
+	auto res = deflate(&zs, Z_FINISH);
+	deflateEnd(&zs);
+	if(res != Z_STREAM_END)
+		throw std::runtime_error{"zlib compression error"};
+	return {std::move(out), size_t(zs.total_out)};
+}
+
 }
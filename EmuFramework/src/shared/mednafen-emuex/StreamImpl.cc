@@ -18,6 +18,8 @@
 #include <mednafen/MemoryStream.h>
 #include <mednafen/mednafen.h>
 #include <imagine/base/ApplicationContext.hh>
+#include <imagine/io/IO.hh>
+#include <imagine/io/FileIO.hh>
 #include <imagine/util/utility.h>
 #include <system_error>
 
@@ -67,6 +69,10 @@ catch(std::system_error &err)
 	throw MDFN_Error(ene.Errno(), _("Error opening file \"%s\": %s"), path.c_str(), ene.StrError());
 }
 
+FileStream::FileStream(IG::IO io, const uint32 mode):
+	io{std::move(io)},
+	attribs{modeToAttribs(mode).second} {}
+
 FileStream::~FileStream() {}
 
 uint64 FileStream::attributes(void)
@@ -149,7 +155,7 @@ uint64 FileStream::size(void)
 
 void FileStream::close(void)
 {
-	io = {};
+	io = IG::IO{};
 }
 
 void FileStream::advise(off_t offset, size_t bytes, IG::IOAdvice advice)
@@ -24,7 +24,7 @@
 
 #include "Stream.h"
 #include "VirtualFS.h"
-#include <imagine/io/FileIO.hh>
+#include <imagine/io/IO.hh>
 
 namespace Mednafen
 {
@@ -61,6 +61,7 @@ class FileStream : public Stream
  };
 
  FileStream(const std::string& path, const uint32 mode, const int do_lock = false, const uint32 buffer_size = 4096);
+ explicit FileStream(IG::IO io, const uint32 mode = MODE_READ);
  virtual ~FileStream() override;
 
  virtual uint64 attributes(void) override;
@@ -96,7 +97,7 @@ class FileStream : public Stream
  uint64 write_ub(const void* data, uint64 count);
  void write_buffered_data(void);
 
- IG::FileIO io;
+ IG::IO io;
  uint8 attribs;
 };
 
@@ -25,6 +25,12 @@
 #include <mednafen/cputest/cputest.h>
 #include <trio/trio.h>
 
+#if defined(HAVE_SSE2_INTRINSICS)
+ #include <emmintrin.h>
+#elif defined(HAVE_NEON_INTRINSICS)
+ #include <arm_neon.h>
+#endif
+
 namespace MDFN_IEN_PCE_FAST
 {
 
@@ -832,6 +838,83 @@ typedef struct
 
 static const unsigned int spr_hpmask = 0x8000;	// High priority bit mask(don't change).
 
+#if defined(HAVE_SSE2_INTRINSICS)
+static INLINE __m128i Reverse16x8(__m128i v)
+{
+ v = _mm_shufflelo_epi16(v, 0x1B);
+ v = _mm_shufflehi_epi16(v, 0x1B);
+ return _mm_shuffle_epi32(v, 0x4E);
+}
+
+static INLINE void BlitSpriteHalf(uint16* dest_pix, const __m128i raw_pixels, const __m128i prio_or)
+{
+ const __m128i transparent = _mm_cmpeq_epi16(raw_pixels, _mm_setzero_si128());
+ const __m128i dest = _mm_loadu_si128((const __m128i*)dest_pix);
+
+ _mm_storeu_si128((__m128i*)dest_pix, _mm_or_si128(_mm_and_si128(transparent, dest), _mm_andnot_si128(transparent, _mm_or_si128(raw_pixels, prio_or))));
+}
+#endif
+
+//
+// Draws one 16-pixel sprite line over dest_pix, leaving dest_pix untouched where the sprite is transparent.
+// Sprites are drawn from lowest to highest priority, so the last write wins.
+//
+static INLINE void BlitSpriteLine(uint16* dest_pix, const uint8* pix_source, const bool hflip, const uint32 prio_or)
+{
+#if defined(HAVE_SSE2_INTRINSICS)
+ const __m128i raw_pixels = _mm_loadu_si128((const __m128i*)pix_source);
+ __m128i lo = _mm_unpacklo_epi8(raw_pixels, _mm_setzero_si128());
+ __m128i hi = _mm_unpackhi_epi8(raw_pixels, _mm_setzero_si128());
+ const __m128i prio_or_v = _mm_set1_epi16(prio_or);
+
+ if(!hflip)
+ {
+  const __m128i tmp = Reverse16x8(hi);
+  hi = Reverse16x8(lo);
+  lo = tmp;
+ }
+
+ BlitSpriteHalf(dest_pix + 0, lo, prio_or_v);
+ BlitSpriteHalf(dest_pix + 8, hi, prio_or_v);
+#elif defined(HAVE_NEON_INTRINSICS)
+ uint8x16_t raw_pixels = vld1q_u8(pix_source);
+ const uint16x8_t prio_or_v = vdupq_n_u16(prio_or);
+
+ if(!hflip)
+ {
+  raw_pixels = vrev64q_u8(raw_pixels);
+  raw_pixels = vcombine_u8(vget_high_u8(raw_pixels), vget_low_u8(raw_pixels));
+ }
+
+ const uint16x8_t lo = vmovl_u8(vget_low_u8(raw_pixels));
+ const uint16x8_t hi = vmovl_u8(vget_high_u8(raw_pixels));
+
+ vst1q_u16(dest_pix + 0, vbslq_u16(vtstq_u16(lo, lo), vorrq_u16(lo, prio_or_v), vld1q_u16(dest_pix + 0)));
+ vst1q_u16(dest_pix + 8, vbslq_u16(vtstq_u16(hi, hi), vorrq_u16(hi, prio_or_v), vld1q_u16(dest_pix + 8)));
+#else
+ // x must be signed, for "pos + x" to not be promoted to unsigned, which will cause a stack overflow.
+ if(hflip)
+ {
+  for(int32 x = 0; x < 16; x++)
+  {
+   const uint32 raw_pixel = pix_source[x];
+   if(raw_pixel)
+    dest_pix[x] = raw_pixel | prio_or;
+  }
+ }
+ else
+ {
+  pix_source += 15;
+  for(int32 x = 0; x < 16; x++)
+  {
+   const uint32 raw_pixel = pix_source[-x];
+   if(raw_pixel)
+    dest_pix[x] = raw_pixel | prio_or;
+  }
+ }
+#endif
+}
+
 // DrawSprites will write up to 0x20 units before the start of the pointer it's passed.
 static NO_INLINE void DrawSprites(vdc_t *vdc, const int32 end, uint16 *spr_linebuf)
 {
@@ -965,35 +1048,61 @@ static NO_INLINE void DrawSprites(vdc_t *vdc, const int32 end, uint16 *spr_lineb
   {
    const uint8 *pix_source = vdc->spr_tile_cache[SpriteList[i].no][SpriteList[i].sub_y];
 
-   // x must be signed, for "pos + x" to not be promoted to unsigned, which will cause a stack overflow.
-   if(SpriteList[i].flags & SPRF_HFLIP)
-   {
-    for(int32 x = 0; x < 16; x++)
-    {
-     const uint32 raw_pixel = pix_source[x];
-     if(raw_pixel)
-      dest_pix[x] = raw_pixel | prio_or;
-    }
-   }
-   else
-   {
-    pix_source += 15;
-    for(int32 x = 0; x < 16; x++)
-    {
-     const uint32 raw_pixel = pix_source[-x];
-     if(raw_pixel)
-      dest_pix[x] = raw_pixel | prio_or;
-    }
-   }
-
+   BlitSpriteLine(dest_pix, pix_source, SpriteList[i].flags & SPRF_HFLIP, prio_or);
   } // End no sprite0 hit
  }
 }
 
+#if defined(HAVE_SSE2_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+//
+// Resolves BG/sprite priority for 8 pixels at once, writing color_table_cache indices to index.
+// The sprite pixel wins if it has the high priority bit set or if the BG pixel is transparent.
+//
+static INLINE void MixBGSPRIndex8(const uint8* bg_linebuf, const uint16* spr_linebuf, uint16* index)
+{
+#if defined(HAVE_SSE2_INTRINSICS)
+ const __m128i bg_pixels = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)bg_linebuf), _mm_setzero_si128());
+ const __m128i spr_pixels = _mm_loadu_si128((const __m128i*)spr_linebuf);
+ const __m128i use_spr = _mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(bg_pixels, _mm_set1_epi16(0xF)), _mm_setzero_si128()), _mm_srai_epi16(spr_pixels, 15));
+ const __m128i pixels = _mm_or_si128(_mm_and_si128(use_spr, spr_pixels), _mm_andnot_si128(use_spr, bg_pixels));
+
+ _mm_store_si128((__m128i*)index, _mm_and_si128(pixels, _mm_set1_epi16(0x1FF)));
+#else
+ const uint16x8_t bg_pixels = vmovl_u8(vld1_u8(bg_linebuf));
+ const uint16x8_t spr_pixels = vld1q_u16(spr_linebuf);
+ const uint16x8_t use_spr = vorrq_u16(vceqq_u16(vandq_u16(bg_pixels, vdupq_n_u16(0xF)), vdupq_n_u16(0)), vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(spr_pixels), 15)));
+
+ vst1q_u16(index, vandq_u16(vbslq_u16(use_spr, spr_pixels, bg_pixels), vdupq_n_u16(0x1FF)));
+#endif
+}
+#endif
+
 template<typename T>
 static void MixBGSPR(const uint32 count, const uint8*  MDFN_RESTRICT bg_linebuf, const uint16*  MDFN_RESTRICT spr_linebuf, T* MDFN_RESTRICT target)
 {
-#ifdef ARCH_X86
+#if defined(HAVE_SSE2_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+ uint32 x = 0;
+
+ for(; MDFN_LIKELY((x + 8) <= count); x += 8)
+ {
+  alignas(16) uint16 index[8];
+
+  MixBGSPRIndex8(bg_linebuf + x, spr_linebuf + x, index);
+
+  for(unsigned i = 0; i < 8; i++)
+   target[x + i] = vce.color_table_cache[index[i]];
+ }
+
+ for(; x < count; x++)
+ {
+  uint32 pixel = bg_linebuf[x] | (spr_linebuf[x] << 16);
+
+  if((int32)(pixel & 0x8000000F) <= 0)
+   pixel >>= 16;
+
+  target[x] = vce.color_table_cache[pixel & 0x1FF];
+ }
+#elif defined(ARCH_X86)
  bg_linebuf += count;
  spr_linebuf += count;
  target += count;
@@ -1088,6 +1197,117 @@ static void MixNone(const uint32 count, T* MDFN_RESTRICT target)
 static const int prio_select[4] = { 1, 1, 0, 0 };
 static const int prio_shift[4] = { 4, 0, 4, 0 };
 
+#if defined(HAVE_SSE2_INTRINSICS)
+static INLINE __m128i MixVPC4(const uint32* lb0, const uint32* lb1, const uint8 pb)
+{
+ const __m128i amask_v = _mm_set1_epi32(amask);
+ __m128i vdc1_pixel, vdc2_pixel;
+
+ vdc2_pixel = vdc1_pixel = _mm_set1_epi32(vce.color_table_cache[0]);
+
+ if(pb & 1)
+  vdc1_pixel = _mm_loadu_si128((const __m128i*)lb0);
+
+ if(pb & 2)
+  vdc2_pixel = _mm_loadu_si128((const __m128i*)lb1);
+
+ switch(pb >> 2)
+ {
+  case 1:
+	vdc1_pixel = _mm_or_si128(vdc1_pixel, _mm_and_si128(_mm_srli_epi32(_mm_and_si128(_mm_xor_si128(vdc2_pixel, vdc1_pixel), vdc2_pixel), 2), amask_v));
+	break;
+
+  case 2:
+	{
+	 const __m128i intermediate = _mm_srli_epi32(_mm_and_si128(_mm_xor_si128(vdc1_pixel, vdc2_pixel), vdc1_pixel), 2);
+	 vdc1_pixel = _mm_or_si128(vdc1_pixel, _mm_and_si128(_mm_and_si128(_mm_xor_si128(intermediate, vdc2_pixel), intermediate), amask_v));
+	}
+	break;
+ }
+
+ const __m128i use_vdc1 = _mm_cmpeq_epi32(_mm_and_si128(vdc1_pixel, amask_v), _mm_setzero_si128());
+
+ return _mm_or_si128(_mm_and_si128(use_vdc1, vdc1_pixel), _mm_andnot_si128(use_vdc1, vdc2_pixel));
+}
+
+template<typename T>
+static INLINE void StoreVPC8(T* target, const __m128i a, const __m128i b)
+{
+ if constexpr(sizeof(T) == 4)
+ {
+  _mm_storeu_si128((__m128i*)target + 0, a);
+  _mm_storeu_si128((__m128i*)target + 1, b);
+ }
+ else
+ {
+  // Sign-extend the low 16 bits first so the saturating pack truncates instead.
+  _mm_storeu_si128((__m128i*)target, _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16)));
+ }
+}
+#elif defined(HAVE_NEON_INTRINSICS)
+static INLINE uint32x4_t MixVPC4(const uint32* lb0, const uint32* lb1, const uint8 pb)
+{
+ const uint32x4_t amask_v = vdupq_n_u32(amask);
+ uint32x4_t vdc1_pixel, vdc2_pixel;
+
+ vdc2_pixel = vdc1_pixel = vdupq_n_u32(vce.color_table_cache[0]);
+
+ if(pb & 1)
+  vdc1_pixel = vld1q_u32(lb0);
+
+ if(pb & 2)
+  vdc2_pixel = vld1q_u32(lb1);
+
+ switch(pb >> 2)
+ {
+  case 1:
+	vdc1_pixel = vorrq_u32(vdc1_pixel, vandq_u32(vshrq_n_u32(vandq_u32(veorq_u32(vdc2_pixel, vdc1_pixel), vdc2_pixel), 2), amask_v));
+	break;
+
+  case 2:
+	{
+	 const uint32x4_t intermediate = vshrq_n_u32(vandq_u32(veorq_u32(vdc1_pixel, vdc2_pixel), vdc1_pixel), 2);
+	 vdc1_pixel = vorrq_u32(vdc1_pixel, vandq_u32(vandq_u32(veorq_u32(intermediate, vdc2_pixel), intermediate), amask_v));
+	}
+	break;
+ }
+
+ return vbslq_u32(vtstq_u32(vdc1_pixel, amask_v), vdc2_pixel, vdc1_pixel);
+}
+
+template<typename T>
+static INLINE void StoreVPC8(T* target, const uint32x4_t a, const uint32x4_t b)
+{
+ if constexpr(sizeof(T) == 4)
+ {
+  vst1q_u32((uint32*)target + 0, a);
+  vst1q_u32((uint32*)target + 4, b);
+ }
+ else
+  vst1q_u16((uint16*)target, vcombine_u16(vmovn_u32(a), vmovn_u32(b)));
+}
+#endif
+
+//
+// Mixes pixels [x, end) of the two VDC line buffers with a single priority setting.
+//
+template<typename T>
+static INLINE void MixVPCSpan(uint32 x, const uint32 end, const uint8 pb, const uint32* MDFN_RESTRICT lb0, const uint32* MDFN_RESTRICT lb1, T* MDFN_RESTRICT target)
+{
+#if defined(HAVE_SSE2_INTRINSICS) || defined(HAVE_NEON_INTRINSICS)
+ if constexpr(sizeof(T) != 1)
+ {
+  for(; MDFN_LIKELY((x + 8) <= end); x += 8)
+   StoreVPC8(target + x, MixVPC4(lb0 + x, lb1 + x, pb), MixVPC4(lb0 + x + 4, lb1 + x + 4, pb));
+ }
+#endif
+
+ for(; x < end; x++)
+ {
+  #include "vpc_mix_inner.inc"
+ }
+}
+
 template<typename T>
 static void MixVPC(const uint32 count, const uint32* MDFN_RESTRICT lb0, const uint32* MDFN_RESTRICT lb1, T*  MDFN_RESTRICT target)
 {
@@ -1096,43 +1316,18 @@ static void MixVPC(const uint32 count, const uint32* MDFN_RESTRICT lb0, const ui
 	{
 	 const uint8 pb = (vpc.priority[prio_select[0]] >> prio_shift[0]) & 0xF;
 
+	 // Constant pb for the common settings lets the compiler drop the unused selects.
 	 switch(pb)
 	 {
 	  default:
 	  	  //printf("%02x\n", pb);
-		  for(int x = 0; MDFN_LIKELY(x < (int)count); x++)
-		  {	 
-		   #include "vpc_mix_inner.inc"
-		  }
-		  break;
-
-	  case 0x3:
-		  for(int x = 0; MDFN_LIKELY(x < (int)count); x++)
-		  {	 
-		   #include "vpc_mix_inner.inc"
-		  }
-		  break;
-
-	  case 0x7:
-		  for(int x = 0; MDFN_LIKELY(x < (int)count); x++)
-		  {	 
-		   #include "vpc_mix_inner.inc"
-		  }
+		  MixVPCSpan(0, count, pb, lb0, lb1, target);
 		  break;
 
-	  case 0xB:
-		  for(int x = 0; MDFN_LIKELY(x < (int)count); x++)
-		  {	 
-		   #include "vpc_mix_inner.inc"
-		  }
-		  break;
-
-	  case 0xF:
-		  for(int x = 0; MDFN_LIKELY(x < (int)count); x++)
-		  {	 
-		   #include "vpc_mix_inner.inc"
-		  }
-		  break;
+	  case 0x3: MixVPCSpan(0, count, 0x3, lb0, lb1, target); break;
+	  case 0x7: MixVPCSpan(0, count, 0x7, lb0, lb1, target); break;
+	  case 0xB: MixVPCSpan(0, count, 0xB, lb0, lb1, target); break;
+	  case 0xF: MixVPCSpan(0, count, 0xF, lb0, lb1, target); break;
 	 }
 
 	 //switch(pb & 0xF)
@@ -1144,19 +1339,31 @@ static void MixVPC(const uint32 count, const uint32* MDFN_RESTRICT lb0, const ui
 	 //	    break;
          //}
 	}
-	else for(int x = 0; x < (int)count; x++)
-	{    
-	 int in_window = 0;
+	else
+	{
+	 const int32 win_end[2] = { vpc.winwidths[0] - 0x40, vpc.winwidths[1] - 0x40 };
+	 uint32 x = 0;
 
-	 if(x < (vpc.winwidths[0] - 0x40))
-	  in_window |= 1;
+	 // The window state only changes at the two window edges, so mix each span between them in one go.
+	 while(x < count)
+	 {
+	  int in_window = 0;
+	  uint32 span_end = count;
 
-	 if(x < (vpc.winwidths[1] - 0x40))
-	  in_window |= 2;
+	  for(unsigned w = 0; w < 2; w++)
+	  {
+	   if((int32)x < win_end[w])
+	   {
+	    in_window |= 1 << w;
+	    span_end = std::min<uint32>(span_end, win_end[w]);
+	   }
+	  }
 
-	 uint8 pb = (vpc.priority[prio_select[in_window]] >> prio_shift[in_window]) & 0xF;
+	  const uint8 pb = (vpc.priority[prio_select[in_window]] >> prio_shift[in_window]) & 0xF;
 
-	 #include "vpc_mix_inner.inc"
+	  MixVPCSpan(x, span_end, pb, lb0, lb1, target);
+	  x = span_end;
+	 }
 	}
 }
 
@@ -214,8 +214,9 @@ void Blip_Synth_Fast_::volume_unit( double new_unit )
 
 #if !BLIP_BUFFER_FAST
 
-Blip_Synth_::Blip_Synth_( short* p, int w ) :
+Blip_Synth_::Blip_Synth_( short* p, short* k, int w ) :
 	impulses( p ),
+	kernels( k ),
 	width( w )
 {
 	volume_unit_ = 0.0;
@@ -299,6 +300,8 @@ void Blip_Synth_::adjust_impulse()
 	//for ( int i = blip_res; i--; printf( "\n" ) )
 	//  for ( int j = 0; j < width / 2; j++ )
 	//      printf( "%5ld,", impulses [j * blip_res + i + 1] );
+	
+	EmuEx::Blip::expandKernels( kernels, impulses, blip_res, width );
 }
 
 void Blip_Synth_::treble_eq( blip_eq_t const& eq )
@@ -9,6 +9,7 @@
 
 #include <limits.h>
 #include <inttypes.h>
+#include <emuframework/BlipKernel.hh>
 
 // Blip_Buffer 0.4.1
 #ifndef BLIP_BUFFER_H
@@ -176,11 +177,12 @@ private:
 		int delta_factor;
 		
 		void volume_unit( double );
-		Blip_Synth_( short* impulses, int width );
+		Blip_Synth_( short* impulses, short* kernels, int width );
 		void treble_eq( blip_eq_t const& );
 	private:
 		double volume_unit_;
 		short* const impulses;
+		short* const kernels;
 		int const width;
 		blip_long kernel_unit;
 		int impulses_size() const { return blip_res / 2 * width + 1; }
@@ -238,8 +240,10 @@ private:
 	Blip_Synth_ impl;
 	typedef short imp_t;
 	imp_t impulses [blip_res * (quality / 2) + 1];
+	// impulses expanded to a contiguous kernel per phase for EmuEx::Blip::addImpulse()
+	alignas(16) imp_t kernels [blip_res * quality];
 public:
-	Blip_Synth() : impl( impulses, quality ) { }
+	Blip_Synth() : impl( impulses, kernels, quality ) { }
 #endif
 };
 
@@ -367,92 +371,11 @@ blip_inline void Blip_Synth<quality,range>::offset_resampled( blip_resampled_tim
 	buf [0] = left;
 	buf [1] = right;
 #else
-
 	int const fwd = (blip_widest_impulse_ - quality) / 2;
-	int const rev = fwd + quality - 2;
-	int const mid = quality / 2 - 1;
-	
-	imp_t const* BLIP_RESTRICT imp = impulses + blip_res - phase;
-	
-	#if defined (_M_IX86) || defined (_M_IA64) || defined (__i486__) || \
-			defined (__x86_64__) || defined (__ia64__) || defined (__i386__)
-	
-	// straight forward implementation resulted in better code on GCC for x86
-	
-	#define ADD_IMP( out, in ) \
-		buf [out] += (blip_long) imp [blip_res * (in)] * delta
-	
-	#define BLIP_FWD( i ) {\
-		ADD_IMP( fwd     + i, i     );\
-		ADD_IMP( fwd + 1 + i, i + 1 );\
-	}
-	#define BLIP_REV( r ) {\
-		ADD_IMP( rev     - r, r + 1 );\
-		ADD_IMP( rev + 1 - r, r     );\
-	}
-
-		BLIP_FWD( 0 )
-		if ( quality > 8  ) BLIP_FWD( 2 )
-		if ( quality > 12 ) BLIP_FWD( 4 )
-		{
-			ADD_IMP( fwd + mid - 1, mid - 1 );
-			ADD_IMP( fwd + mid    , mid     );
-			imp = impulses + phase;
-		}
-		if ( quality > 12 ) BLIP_REV( 6 )
-		if ( quality > 8  ) BLIP_REV( 4 )
-		BLIP_REV( 2 )
-		
-		ADD_IMP( rev    , 1 );
-		ADD_IMP( rev + 1, 0 );
-		
-	#else
-	
-	// for RISC processors, help compiler by reading ahead of writes
-	
-	#define BLIP_FWD( i ) {\
-		blip_long t0 =                       i0 * delta + buf [fwd     + i];\
-		blip_long t1 = imp [blip_res * (i + 1)] * delta + buf [fwd + 1 + i];\
-		i0 =           imp [blip_res * (i + 2)];\
-		buf [fwd     + i] = t0;\
-		buf [fwd + 1 + i] = t1;\
-	}
-	#define BLIP_REV( r ) {\
-		blip_long t0 =                 i0 * delta + buf [rev     - r];\
-		blip_long t1 = imp [blip_res * r] * delta + buf [rev + 1 - r];\
-		i0 =           imp [blip_res * (r - 1)];\
-		buf [rev     - r] = t0;\
-		buf [rev + 1 - r] = t1;\
-	}
-		
-		blip_long i0 = *imp;
-		BLIP_FWD( 0 )
-		if ( quality > 8  ) BLIP_FWD( 2 )
-		if ( quality > 12 ) BLIP_FWD( 4 )
-		{
-			blip_long t0 =                   i0 * delta + buf [fwd + mid - 1];
-			blip_long t1 = imp [blip_res * mid] * delta + buf [fwd + mid    ];
-			imp = impulses + phase;
-			i0 = imp [blip_res * mid];
-			buf [fwd + mid - 1] = t0;
-			buf [fwd + mid    ] = t1;
-		}
-		if ( quality > 12 ) BLIP_REV( 6 )
-		if ( quality > 8  ) BLIP_REV( 4 )
-		BLIP_REV( 2 )
-		
-		blip_long t0 =   i0 * delta + buf [rev    ];
-		blip_long t1 = *imp * delta + buf [rev + 1];
-		buf [rev    ] = t0;
-		buf [rev + 1] = t1;
-	#endif
-	
+	EmuEx::Blip::addImpulse<quality>( buf + fwd, kernels + phase * quality, delta );
 #endif
 }
 
-#undef BLIP_FWD
-#undef BLIP_REV
-
 template<int quality,int range>
 #if BLIP_BUFFER_FAST
 	blip_inline
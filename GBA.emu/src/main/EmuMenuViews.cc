@@ -417,6 +417,16 @@ class CustomSystemOptionView : public SystemOptionView, public MainAppHelper<Cus
 	}
 	#endif
 
+	BoolMenuItem renderThread
+	{
+		"Render Video On Separate Thread", &defaultFace(),
+		CPUIsRenderThreaded(),
+		[this](BoolMenuItem &item)
+		{
+			CPUSetRenderThreaded(gGba, item.flipBoolValue(*this));
+		}
+	};
+
 public:
 	CustomSystemOptionView(ViewAttachParams attach): SystemOptionView{attach, true}
 	{
@@ -424,6 +434,7 @@ public:
 		#ifdef IG_CONFIG_SENSORS
 		item.emplace_back(&lightSensorScale);
 		#endif
+		item.emplace_back(&renderThread);
 	}
 };
 
@@ -277,9 +277,57 @@ struct GBALCD
 	int layerEnableDelay{};
 	int lcdTicks{};
 	uint16_t gfxLastVCOUNT{};
+	// CPU side copies of layerEnable & gfxBGxChanged, latched into the above
+	// fields when a line is drawn so the line can be drawn on another thread
+	unsigned cpuLayerEnable{};
+	int cpuBG2Changed{};
+	int cpuBG3Changed{};
+	int gfxWin0H{-1}; // WINxH values gfxInWin0/1 were built from
+	int gfxWin1H{-1};
+	bool renderPending{}; // render thread is drawing a line
+
+	// wait for any line being drawn on the render thread before
+	// modifying memory or buffers it reads from
+	void renderSync()
+	{
+		if(renderPending) [[unlikely]]
+			waitForRenderThread();
+	}
+
+	void waitForRenderThread();
+
+	static void updateWindow(bool (&inWin)[240], uint16_t winH)
+	{
+		int x00 = winH >> 8;
+		int x01 = winH & 255;
+		if (x00 <= x01) {
+			for (int i = 0; i < 240; i++) {
+				inWin[i] = (i >= x00 && i < x01);
+			}
+		} else {
+			for (int i = 0; i < 240; i++) {
+				inWin[i] = (i >= x00 || i < x01);
+			}
+		}
+	}
+
+	void updateWindows(uint16_t win0H, uint16_t win1H)
+	{
+		if(win0H != gfxWin0H)
+		{
+			gfxWin0H = win0H;
+			updateWindow(gfxInWin0, win0H);
+		}
+		if(win1H != gfxWin1H)
+		{
+			gfxWin1H = win1H;
+			updateWindow(gfxInWin1, win1H);
+		}
+	}
 
 	void registerRamReset(uint32_t flags)
 	{
+		renderSync();
     if(flags & 0x04) {
       // clear palette RAM
       memset(paletteRAM, 0, 0x400);
@@ -306,7 +354,7 @@ struct GBALCD
 	{
 		reset();
 		ioMem.resetLcdRegs(useBios, skipBios);
-		layerEnable = ioMem.DISPCNT & coreOptions.layerSettings;
+		cpuLayerEnable = ioMem.DISPCNT & coreOptions.layerSettings;
 	}
 };
 
@@ -25,6 +25,7 @@ enum
 	CFGKEY_SOUND_FILTERING = 260, CFGKEY_SOUND_INTERPOLATION = 261,
 	CFGKEY_SENSOR_TYPE = 262, CFGKEY_LIGHT_SENSOR_SCALE = 263,
 	CFGKEY_CHEATS_PATH = 264, CFGKEY_PATCHES_PATH = 265,
+	CFGKEY_RENDER_THREAD = 266,
 };
 
 void readCheatFile(class EmuSystem &);
@@ -56,6 +56,7 @@ bool GbaSystem::readConfig(ConfigType type, MapIO &io, unsigned key, size_t read
 			case CFGKEY_LIGHT_SENSOR_SCALE: return readOptionValue<uint16_t>(io, readSize, [&](auto val){lightSensorScaleLux = val;});
 			case CFGKEY_CHEATS_PATH: return readStringOptionValue(io, readSize, cheatsDir);
 			case CFGKEY_PATCHES_PATH: return readStringOptionValue(io, readSize, patchesDir);
+			case CFGKEY_RENDER_THREAD: return readOptionValue<bool>(io, readSize, [](auto on){CPUSetRenderThreaded(gGba, on);});
 		}
 	}
 	else if(type == ConfigType::SESSION)
@@ -82,6 +83,7 @@ void GbaSystem::writeConfig(ConfigType type, FileIO &io)
 		writeOptionValueIfNotDefault(io, CFGKEY_LIGHT_SENSOR_SCALE, (uint16_t)lightSensorScaleLux, (uint16_t)lightSensorScaleLuxDefault);
 		writeStringOptionValue(io, CFGKEY_CHEATS_PATH, cheatsDir);
 		writeStringOptionValue(io, CFGKEY_PATCHES_PATH, patchesDir);
+		writeOptionValueIfNotDefault(io, CFGKEY_RENDER_THREAD, CPUIsRenderThreaded(), false);
 	}
 	else if(type == ConfigType::SESSION)
 	{
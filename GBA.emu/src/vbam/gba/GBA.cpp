@@ -33,7 +33,9 @@
 #include <imagine/base/ApplicationContext.hh>
 #include <imagine/util/algorithm.h>
 #include <imagine/util/ScopeGuard.hh>
+#include <imagine/thread/Semaphore.hh>
 #include <emuframework/EmuSystemTaskContext.hh>
+#include <thread>
 
 #ifdef PROFILING
 #include "prof/prof.h"
@@ -115,6 +117,111 @@ constexpr bool trackOAM = 1, oamUpdated = 1;
 int armOpcodeCount = 0;
 int thumbOpcodeCount = 0;
 
+static void drawLine(GBALCD &lcd, GBALCD::RenderLineFunc renderLine, MixColorType *lineMix,
+	const GBAMem::IoMem &ioMem, unsigned layerEnable, int bg2Changed, int bg3Changed)
+{
+	lcd.layerEnable = layerEnable;
+	lcd.gfxBG2Changed |= bg2Changed;
+	lcd.gfxBG3Changed |= bg3Changed;
+	lcd.updateWindows(ioMem.WIN0H, ioMem.WIN1H);
+	renderLine(lineMix, lcd, ioMem);
+}
+
+// Render thread
+
+static struct RenderThread
+{
+	static constexpr size_t lcdRegsSize = 0x56; // DISPCNT through COLY
+
+	std::thread thread;
+	std::binary_semaphore lineSem{0}, lineDoneSem{0};
+	GBAMem::IoMem ioMem{}; // LCD registers latched when the line was queued
+	GBALCD *lcd{};
+	GBALCD::RenderLineFunc renderLine{};
+	MixColorType *lineMix{};
+	unsigned layerEnable{};
+	int bg2Changed{};
+	int bg3Changed{};
+	bool quit{};
+
+	~RenderThread() { stop(); }
+
+	void start()
+	{
+		if(thread.joinable())
+			return;
+		quit = false;
+		thread = std::thread{[this]()
+		{
+			logMsg("starting LCD render thread");
+			for(;;)
+			{
+				lineSem.acquire();
+				if(quit)
+					return;
+				drawLine(*lcd, renderLine, lineMix, ioMem, layerEnable, bg2Changed, bg3Changed);
+				lineDoneSem.release();
+			}
+		}};
+	}
+
+	void stop()
+	{
+		if(!thread.joinable())
+			return;
+		quit = true;
+		lineSem.release();
+		thread.join();
+		logMsg("stopped LCD render thread");
+	}
+} renderThread;
+
+void GBALCD::waitForRenderThread()
+{
+	renderThread.lineDoneSem.acquire();
+	renderPending = false;
+}
+
+void CPUSetRenderThreaded(GBASys &gba, bool on)
+{
+	if(on)
+	{
+		renderThread.start();
+	}
+	else
+	{
+		gba.lcd.renderSync();
+		renderThread.stop();
+	}
+}
+
+bool CPUIsRenderThreaded() { return renderThread.thread.joinable(); }
+
+// Draws the current line into lineMix, either directly or by queuing it on the render
+// thread with a copy of the LCD registers so the CPU can run ahead during H-Blank.
+// Any write to VRAM, palette, or OAM waits for the queued line first.
+static void CPURenderLine(GBASys &gba)
+{
+	auto &lcd = gba.lcd;
+	int bg2Changed = std::exchange(lcd.cpuBG2Changed, 0);
+	int bg3Changed = std::exchange(lcd.cpuBG3Changed, 0);
+	if(!renderThread.thread.joinable())
+	{
+		drawLine(lcd, lcd.renderLine, lcd.lineMix, gba.mem.ioMem, lcd.cpuLayerEnable, bg2Changed, bg3Changed);
+		return;
+	}
+	lcd.renderSync();
+	std::copy_n(gba.mem.ioMem.b, RenderThread::lcdRegsSize, renderThread.ioMem.b);
+	renderThread.lcd = &lcd;
+	renderThread.renderLine = lcd.renderLine;
+	renderThread.lineMix = lcd.lineMix;
+	renderThread.layerEnable = lcd.cpuLayerEnable;
+	renderThread.bg2Changed = bg2Changed;
+	renderThread.bg3Changed = bg3Changed;
+	lcd.renderPending = true;
+	renderThread.lineSem.release();
+}
+
 constexpr int TIMER_TICKS[4] = {
   0,
   6,
@@ -532,12 +639,10 @@ static int romSize = SIZE_ROM;
 #define DISPSTAT gba.mem.ioMem.DISPSTAT
 #define VCOUNT gba.mem.ioMem.VCOUNT
 #define layerEnableDelay gba.lcd.layerEnableDelay
-#define layerEnable gba.lcd.layerEnable
+#define layerEnable gba.lcd.cpuLayerEnable
 #define windowOn gba.lcd.windowOn
-#define gfxBG2Changed gba.lcd.gfxBG2Changed
-#define gfxBG3Changed gba.lcd.gfxBG3Changed
-#define gfxInWin0 gba.lcd.gfxInWin0
-#define gfxInWin1 gba.lcd.gfxInWin1
+#define gfxBG2Changed gba.lcd.cpuBG2Changed
+#define gfxBG3Changed gba.lcd.cpuBG3Changed
 #define fxOn gba.lcd.fxOn
 #define bios gba.mem.bios
 #define cpuDmaCount gba.dma.cpuDmaCount
@@ -625,41 +730,7 @@ inline int CPUUpdateTicks(ARM7TDMI &cpu)
   return cpuLoopTicks;
 }
 
-static void CPUUpdateWindow0(GBASys &gba)
-{
-  int x00 = WIN0H >> 8;
-  int x01 = WIN0H & 255;
-
-  if (x00 <= x01) {
-    for (int i = 0; i < 240; i++) {
-      gfxInWin0[i] = (i >= x00 && i < x01);
-    }
-  } else {
-    for (int i = 0; i < 240; i++) {
-    	gfxInWin0[i] = (i >= x00 || i < x01);
-    }
-  }
-}
-
-static void CPUUpdateWindow1(GBASys &gba)
-{
-  int x00 = WIN1H >> 8;
-  int x01 = WIN1H & 255;
-
-  if (x00 <= x01) {
-    for (int i = 0; i < 240; i++) {
-    	gfxInWin1[i] = (i >= x00 && i < x01);
-    }
-  } else {
-    for (int i = 0; i < 240; i++) {
-    	gfxInWin1[i] = (i >= x00 || i < x01);
-    }
-  }
-}
-
 #define CPUUpdateTicks() CPUUpdateTicks(cpu)
-#define CPUUpdateWindow0() CPUUpdateWindow0(gba)
-#define CPUUpdateWindow1() CPUUpdateWindow1(gba)
 #define line0 gba.lcd.line0
 #define line1 gba.lcd.line1
 #define line2 gba.lcd.line2
@@ -690,6 +761,7 @@ static void CPUUpdateWindow1(GBASys &gba)
 
 static void CPUUpdateRenderBuffers(GBASys &gba, bool force)
 {
+  gba.lcd.renderSync();
   if (!(layerEnable & 0x0100) || force) {
     CLEAR_ARRAY(line0);
   }
@@ -794,9 +866,6 @@ bool CPUReadState(const uint8_t* data)
     CLEAR_ARRAY(line3);
     // End of CPU Update Render Buffers set to true
 
-    CPUUpdateWindow0();
-    CPUUpdateWindow1();
-
     SetSaveType(coreOptions.saveType);
 
     systemSaveUpdateCounter = SYSTEM_SAVE_NOT_UPDATED;
@@ -1032,8 +1101,6 @@ static bool CPUReadState(GBASys &gba, gzFile gzFile)
 
   CPUUpdateRender(gba);
   CPUUpdateRenderBuffers(true);
-  CPUUpdateWindow0();
-  CPUUpdateWindow1();
 
   SetSaveType(coreOptions.saveType);
 
@@ -2836,12 +2903,10 @@ void CPUUpdateRegister(ARM7TDMI &cpu, uint32_t address, uint16_t value)
   case 0x40:
   	WIN0H = value;
     UPDATE_REG(0x40, WIN0H);
-    CPUUpdateWindow0();
     break;
   case 0x42:
   	WIN1H = value;
     UPDATE_REG(0x42, WIN1H);
-    CPUUpdateWindow1();
     break;
   case 0x44:
   	WIN0V = value;
@@ -3621,9 +3686,6 @@ void CPUReset(GBASys &gba)
 
   soundReset(gba);
 
-  CPUUpdateWindow0();
-  CPUUpdateWindow1();
-
   // make sure registers are correctly initialized if not using BIOS
   if (!coreOptions.useBios) {
     if (coreOptions.cpuIsMultiBoot)
@@ -4057,11 +4119,12 @@ void CPULoop(GBASys &gba, EmuEx::EmuSystemTaskContext taskCtx, EmuEx::EmuVideo *
             	else
             	{
             	}*/
-              (*gba.lcd.renderLine)(gba.lcd.lineMix, gba.lcd, ioMem);
+              CPURenderLine(gba);
             }
             if (VCOUNT == 159)
             {
             	cpuBreakLoop = true;
+            	gba.lcd.renderSync();
               if (video)
               {
             	  systemDrawScreen(taskCtx, *video);
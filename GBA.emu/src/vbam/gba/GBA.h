@@ -160,6 +160,8 @@ extern bool CPUWriteBMPFile(const char*);
 extern void CPUCleanUp();
 extern void CPUUpdateRender(GBASys &gba);
 extern void CPUUpdateRenderBuffers(bool);
+extern void CPUSetRenderThreaded(GBASys &gba, bool on);
+extern bool CPUIsRenderThreaded();
 extern bool CPUReadMemState(GBASys &gba, char *, int);
 extern bool CPUWriteMemState(GBASys &gba, char *, int);
 #ifdef __LIBRETRO__
@@ -66,6 +66,16 @@ void LynxSystem::saveState(IG::CStringView path)
 		throwFileWriteError();
 }
 
+ByteBuffer LynxSystem::saveStateToBuffer()
+{
+	return saveStateToBufferMDFN();
+}
+
+ByteBuffer LynxSystem::stateFileData(ByteBuffer buff) const
+{
+	return stateFileDataMDFN(std::move(buff));
+}
+
 void LynxSystem::loadState(EmuApp &, IG::CStringView path)
 {
 	if(!MDFNI_LoadState(path, 0))
@@ -113,9 +123,14 @@ void LynxSystem::configAudioRate(FrameTime outputFrameTime, int outputRate)
 }
 
 void LynxSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio)
+{
+	runFrames(taskCtx, video, audio, 1);
+}
+
+void LynxSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
 {
 	static constexpr size_t maxAudioFrames = 48000 / 20; // May output a large amount of audio samples during boot
-	EmuEx::runFrame(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames);
+	EmuEx::runFrames(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames, frames);
 	if(configuredHCount != Lynx_HCount()) [[unlikely]]
 	{
 		onFrameTimeChanged();
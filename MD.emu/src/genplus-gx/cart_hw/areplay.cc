@@ -251,6 +251,9 @@ void areplay_set_status(int status)
       }
     }
 
+    /* discard any predecoded instructions using the old ROM data */
+    m68k_flush_code_cache(mm68k);
+
     /* update status */
     action_replay.status = status;
   }
@@ -150,6 +150,9 @@ void ggenie_switch(int enable)
       }
     }
   }
+
+  /* discard any predecoded instructions using the old ROM data */
+  m68k_flush_code_cache(mm68k);
 }
 
 static unsigned int ggenie_read_byte(unsigned int address)
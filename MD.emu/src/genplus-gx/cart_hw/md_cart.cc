@@ -677,6 +677,16 @@ void md_cart_init(void)
 	#ifndef NO_SCD
 		if(sCD.isActive) scd_memmap();
 	#endif
+
+  /* predecode 68k instructions executed from the cartridge ROM, the rest of
+     cart.rom holds SVP, SRAM, Game Genie & Action Replay memory that's
+     written while running */
+  uint32 codeCacheSize = (cart.romsize + 0xffff) & ~0xffff;
+  #ifndef NO_SVP
+  if (svp && (uint8 *)svp < cart.rom + codeCacheSize)
+    codeCacheSize = (uint8 *)svp - cart.rom;
+  #endif
+  m68k_set_code_cache_region(mm68k, cart.rom, codeCacheSize);
 }
 
 /* hardware that need to be reseted on power on */
@@ -1006,6 +1016,9 @@ static void mapper_32k_w(uint32 data)
       memcpy(mm68k.memory_map[i].base, cart.rom + ((i << 16) | (data & 0x3f) << 15), 0x8000);
       memcpy(mm68k.memory_map[i].base + 0x8000, cart.rom + ((i << 16) | ((data | 1) & 0x3f) << 15), 0x8000);
     }
+
+    /* remapped area was overwritten */
+    m68k_flush_code_cache(mm68k);
   }
   else
   {
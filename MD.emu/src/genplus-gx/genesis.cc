@@ -318,6 +318,7 @@ void gen_bankswitch_w(unsigned int data)
     config.tmss |= 2;
     memcpy(bios_rom, cart.rom, 0x800);
     memset(cart.rom, 0xff, cart.romsize);
+    m68k_flush_code_cache(mm68k);
   }
 
   if (data & 1)
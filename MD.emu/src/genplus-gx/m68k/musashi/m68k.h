@@ -32,6 +32,8 @@
 #include <assert.h>
 #include <imagine/logger/logger.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <memory>
 #include "m68kconf.h"
 
 /* ======================================================================== */
@@ -195,6 +197,38 @@ typedef union
   double f;
 } fp_reg;
 
+struct M68KCPU;
+
+/* Predecoded instruction traces for code executed from a read-only region,
+ * tagged by PC and the host base pointer of its 64KB bank so bank switching
+ * can't return stale entries. Each op stores the opcode, its handler & cycles
+ * so replaying a trace skips the opcode fetch and jump/cycle table lookups.
+ */
+struct M68KCodeCache
+{
+  static constexpr unsigned traces = 512;
+  static constexpr unsigned traceOps = 16;
+
+  struct Op
+  {
+    void (*handler)(M68KCPU &m68ki_cpu);
+    unsigned pc;
+    uint16_t ir;
+    uint8_t cycles;
+  };
+
+  struct Trace
+  {
+    const unsigned char *base;
+    unsigned pc;
+    unsigned size;
+    Op op[traceOps];
+  };
+
+  Trace trace[traces]{};
+  unsigned flushes{}; /* bumped by every flush so a running trace can detect it */
+};
+
 struct M68KCPU
 {
 	constexpr M68KCPU(const unsigned char (&cycles)[0x10000], bool hasWorkingTas):
@@ -284,6 +318,9 @@ struct M68KCPU
   int32_t cycleCount = 0;
   int32_t endCycles = 0;
   _m68k_memory_map memory_map[256]{};
+  std::unique_ptr<M68KCodeCache> codeCache{}; /* allocated on first use */
+  const unsigned char *codeCacheStart{};
+  const unsigned char *codeCacheEnd{};
 
   /* Set the IPL0-IPL2 pins on the CPU (IRQ).
    * A transition from < 7 to 7 will cause a non-maskable interrupt (NMI).
@@ -477,6 +514,21 @@ void m68k_pulse_reset(M68KCPU &m68ki_cpu);
 /* run until global cycle count is reached */
 void m68k_run(M68KCPU &m68ki_cpu, int cycles) __attribute__((hot));
 
+/* Enable the predecoded instruction cache for code fetched from the given
+ * host memory region, which must not be modified while code runs from it
+ * unless m68k_flush_code_cache() is called afterwards. Only 64KB banks lying
+ * entirely inside the region are cached. A size of 0 disables the cache.
+ */
+void m68k_set_code_cache_region(M68KCPU &m68ki_cpu, const unsigned char *start, size_t size);
+
+/* Discard all predecoded instructions, call after patching the cached region */
+void m68k_flush_code_cache(M68KCPU &m68ki_cpu);
+
+/* Release the code cache memory, it's re-allocated the next time code runs
+ * from the cached region
+ */
+void m68k_free_code_cache(M68KCPU &m68ki_cpu);
+
 /* These functions let you read/write/modify the number of cycles left to run
  * while m68k_execute() is running.
  * These are useful if the 68k accesses a memory-mapped port on another device
@@ -927,6 +927,114 @@ void M68KCPU::setIRQDelay(unsigned int mask)
   m68ki_check_interrupts(*this); /* Level triggered (IRQ) */
 }
 
+void m68k_set_code_cache_region(M68KCPU &m68ki_cpu, const unsigned char *start, size_t size)
+{
+#if M68K_EMULATE_PREFETCH || M68K_INSTRUCTION_HOOK
+  /* opcode fetches must always go through m68ki_read_imm_16() */
+  size = 0;
+#endif
+  if (!size)
+  {
+    m68ki_cpu.codeCacheStart = m68ki_cpu.codeCacheEnd = nullptr;
+    m68k_free_code_cache(m68ki_cpu);
+    return;
+  }
+  m68ki_cpu.codeCacheStart = start;
+  m68ki_cpu.codeCacheEnd = start + size;
+  m68k_flush_code_cache(m68ki_cpu);
+}
+
+void m68k_free_code_cache(M68KCPU &m68ki_cpu)
+{
+  m68ki_cpu.codeCache.reset();
+}
+
+void m68k_flush_code_cache(M68KCPU &m68ki_cpu)
+{
+  if (!m68ki_cpu.codeCache)
+    return;
+  for (auto &trace : m68ki_cpu.codeCache->trace)
+  {
+    trace.size = 0;
+  }
+  m68ki_cpu.codeCache->flushes++;
+}
+
+/* Cycles for the instruction just executed, normally the cached value unless
+ * the handler ran another instruction itself (see setIRQDelay)
+ */
+static uint8_t m68ki_op_cycles(M68KCPU &m68ki_cpu, const M68KCodeCache::Op &op)
+{
+  return REG_IR == op.ir ? op.cycles : CYC_INSTRUCTION[REG_IR];
+}
+
+/* Run instructions at the current PC through the code cache, recording a new
+ * trace on a miss. Returns false without executing anything if the PC isn't
+ * inside the cached region.
+ */
+static bool m68ki_run_code_cache(M68KCPU &m68ki_cpu, int cycles)
+{
+  unsigned pc = REG_PC;
+  unsigned bank = (pc >> 16) & 0xff;
+  const unsigned char *base = m68ki_cpu.memory_map[bank].base;
+  if ((pc & 1) || base < m68ki_cpu.codeCacheStart || base + 0x10000 > m68ki_cpu.codeCacheEnd)
+    return false;
+  if (!m68ki_cpu.codeCache) [[unlikely]]
+    m68ki_cpu.codeCache = std::make_unique<M68KCodeCache>();
+  auto &cache = *m68ki_cpu.codeCache;
+  /* An instruction can patch the cached region (mapper writes, SCD vectors,
+     cheats), stop recording or replaying once that flushes the cache */
+  const unsigned flushes = cache.flushes;
+
+  auto &trace = cache.trace[(pc >> 1) & (M68KCodeCache::traces - 1)];
+  if (trace.pc != pc || trace.base != base || !trace.size)
+  {
+    /* Record while executing, each op is committed before running its handler
+       so an address error trap leaves the trace consistent */
+    trace.base = base;
+    trace.pc = pc;
+    trace.size = 0;
+    do
+    {
+      m68ki_trace_t1() /* auto-disable (see m68kcpu.h) */
+      m68ki_use_data_space() /* auto-disable (see m68kcpu.h) */
+      REG_IR = m68ki_read_imm_16(m68ki_cpu);
+      auto &op = trace.op[trace.size];
+      op.handler = m68ki_instruction_jump_table[REG_IR];
+      op.pc = pc;
+      op.ir = REG_IR;
+      op.cycles = CYC_INSTRUCTION[REG_IR];
+      trace.size++;
+      op.handler(m68ki_cpu);
+      USE_CYCLES(m68ki_op_cycles(m68ki_cpu, op));
+      m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+      pc = REG_PC;
+    }
+    while (cache.flushes == flushes && trace.size < M68KCodeCache::traceOps && m68ki_cpu.cycleCount < cycles &&
+      !(pc & 1) && ((pc >> 16) & 0xff) == bank && m68ki_cpu.memory_map[bank].base == base);
+    return true;
+  }
+
+  /* Replay the trace while execution follows the recorded path */
+  const auto *op = trace.op;
+  const auto *end = op + trace.size;
+  do
+  {
+    m68ki_trace_t1() /* auto-disable (see m68kcpu.h) */
+    m68ki_use_data_space() /* auto-disable (see m68kcpu.h) */
+    m68ki_set_fc(FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
+    REG_PC = pc + 2;
+    REG_IR = op->ir;
+    op->handler(m68ki_cpu);
+    USE_CYCLES(m68ki_op_cycles(m68ki_cpu, *op));
+    m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+    pc = REG_PC;
+  }
+  while (cache.flushes == flushes && ++op != end && op->pc == pc && m68ki_cpu.cycleCount < cycles &&
+    m68ki_cpu.memory_map[bank].base == base);
+  return true;
+}
+
 void m68k_run(M68KCPU &m68ki_cpu, int cycles)
 {
   /* Make sure we're not stopped */
@@ -944,6 +1052,10 @@ void m68k_run(M68KCPU &m68ki_cpu, int cycles)
 
   while (m68ki_cpu.cycleCount < cycles)
   {
+    /* Use predecoded instructions when running from ROM */
+    if (m68ki_cpu.codeCacheEnd && m68ki_run_code_cache(m68ki_cpu, cycles))
+      continue;
+
     /* Set tracing accodring to T1. */
     m68ki_trace_t1() /* auto-disable (see m68kcpu.h) */
 
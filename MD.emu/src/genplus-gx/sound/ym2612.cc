@@ -1421,8 +1421,49 @@ INLINE signed int op_calc1(UINT32 phase, unsigned int env, signed int pm)
   return tl_tab[p];
 }
 
+/* update phase counters AFTER output calculations */
+INLINE void update_phase_chan(FM_CH *CH)
+{
+  if(CH->pms)
+  {
+    /* add support for 3 slot mode */
+    if ((ym2612.OPN.ST.mode & 0xC0) && (CH == &ym2612.CH[2]))
+    {
+      update_phase_lfo_slot(&CH->SLOT[SLOT1], CH->pms, ym2612.OPN.SL3.block_fnum[1]);
+      update_phase_lfo_slot(&CH->SLOT[SLOT2], CH->pms, ym2612.OPN.SL3.block_fnum[2]);
+      update_phase_lfo_slot(&CH->SLOT[SLOT3], CH->pms, ym2612.OPN.SL3.block_fnum[0]);
+      update_phase_lfo_slot(&CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+    }
+    else update_phase_lfo_channel(CH);
+  }
+  else  /* no LFO phase modulation */
+  {
+    CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
+    CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
+    CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
+    CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+  }
+}
+
+/* a channel with all operators below ENV_QUIET (AM can only attenuate further), */
+/* no feedback history and no delayed MEM sample outputs nothing & keeps its state */
+INLINE int chan_is_silent(FM_CH *CH)
+{
+  /* SLOT4 is a carrier in every algorithm, test it first so audible channels */
+  /* exit on the first compare */
+  return CH->SLOT[SLOT4].vol_out >= ENV_QUIET && CH->SLOT[SLOT1].vol_out >= ENV_QUIET &&
+         CH->SLOT[SLOT2].vol_out >= ENV_QUIET && CH->SLOT[SLOT3].vol_out >= ENV_QUIET &&
+         !(CH->op1_out[0] | CH->op1_out[1] | CH->mem_value);
+}
+
 INLINE void chan_calc(FM_CH *CH)
 {
+  if (chan_is_silent(CH))
+  {
+    update_phase_chan(CH);
+    return;
+  }
+
   UINT32 AM = ym2612.OPN.LFO_AM >> CH->ams;
 
   m2 = c1 = c2 = mem = 0;
@@ -1468,26 +1509,28 @@ INLINE void chan_calc(FM_CH *CH)
   /* store current MEM */
   CH->mem_value = mem;
 
-  /* update phase counters AFTER output calculations */
-  if(CH->pms)
+  update_phase_chan(CH);
+}
+
+/* clip (optionally) & pan the 6 channel outputs into one stereo sample */
+INLINE void mix_output(FMSampleType *buffer, const UINT32 *pan_l, const UINT32 *pan_r, int clip)
+{
+  int i;
+  long int lt = 0, rt = 0;
+  for (i=0; i<6; i++)
   {
-    /* add support for 3 slot mode */
-    if ((ym2612.OPN.ST.mode & 0xC0) && (CH == &ym2612.CH[2]))
+    INT32 out = out_fm[i];
+    if (clip)
     {
-      update_phase_lfo_slot(&CH->SLOT[SLOT1], CH->pms, ym2612.OPN.SL3.block_fnum[1]);
-      update_phase_lfo_slot(&CH->SLOT[SLOT2], CH->pms, ym2612.OPN.SL3.block_fnum[2]);
-      update_phase_lfo_slot(&CH->SLOT[SLOT3], CH->pms, ym2612.OPN.SL3.block_fnum[0]);
-      update_phase_lfo_slot(&CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+      /* 14-bit DAC inputs (range is -8192;+8192) */
+      if (out > 8192) out = 8192;
+      else if (out < -8192) out = -8192;
     }
-    else update_phase_lfo_channel(CH);
-  }
-  else  /* no LFO phase modulation */
-  {
-    CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-    CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-    CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-    CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+    lt += out & pan_l[i];
+    rt += out & pan_r[i];
   }
+  buffer[0] = lt;
+  buffer[1] = rt;
 }
 
 /* write a OPN mode register 0x20-0x2f */
@@ -2037,7 +2080,7 @@ unsigned int YM2612Read(void)
 void YM2612Update(FMSampleType *buffer, int length)
 {
   int i;
-  long int lt,rt;
+  UINT32 pan_l[6], pan_r[6];
 
   /* refresh PG increments and EG rates if required */
   refresh_fc_eg_chan(&ym2612.CH[0]);
@@ -2060,6 +2103,13 @@ void YM2612Update(FMSampleType *buffer, int length)
   refresh_fc_eg_chan(&ym2612.CH[4]);
   refresh_fc_eg_chan(&ym2612.CH[5]);
 
+  /* split output masks per side, they can't change during an update */
+  for(i=0; i < 6 ; i++)
+  {
+    pan_l[i] = ym2612.OPN.pan[i*2];
+    pan_r[i] = ym2612.OPN.pan[i*2+1];
+  }
+
   /* buffering */
   for(i=0; i < length ; i++)
   {
@@ -2110,40 +2160,9 @@ void YM2612Update(FMSampleType *buffer, int length)
       advance_eg_channel(&ym2612.CH[5].SLOT[SLOT1]);
     }
 
-    /* 14-bit DAC inputs (range is -8192;+8192) */
-    if(config_ym2612_clip)
-    {
-		if (out_fm[0] > 8192) out_fm[0] = 8192;
-		else if (out_fm[0] < -8192) out_fm[0] = -8192;
-		if (out_fm[1] > 8192) out_fm[1] = 8192;
-		else if (out_fm[1] < -8192) out_fm[1] = -8192;
-		if (out_fm[2] > 8192) out_fm[2] = 8192;
-		else if (out_fm[2] < -8192) out_fm[2] = -8192;
-		if (out_fm[3] > 8192) out_fm[3] = 8192;
-		else if (out_fm[3] < -8192) out_fm[3] = -8192;
-		if (out_fm[4] > 8192) out_fm[4] = 8192;
-		else if (out_fm[4] < -8192) out_fm[4] = -8192;
-		if (out_fm[5] > 8192) out_fm[5] = 8192;
-		else if (out_fm[5] < -8192) out_fm[5] = -8192;
-    }
-
     /* 6-channels mixing  */
-    lt  = ((out_fm[0]) & ym2612.OPN.pan[0]);
-    rt  = ((out_fm[0]) & ym2612.OPN.pan[1]);
-    lt += ((out_fm[1]) & ym2612.OPN.pan[2]);
-    rt += ((out_fm[1]) & ym2612.OPN.pan[3]);
-    lt += ((out_fm[2]) & ym2612.OPN.pan[4]);
-    rt += ((out_fm[2]) & ym2612.OPN.pan[5]);
-    lt += ((out_fm[3]) & ym2612.OPN.pan[6]);
-    rt += ((out_fm[3]) & ym2612.OPN.pan[7]);
-    lt += ((out_fm[4]) & ym2612.OPN.pan[8]);
-    rt += ((out_fm[4]) & ym2612.OPN.pan[9]);
-    lt += ((out_fm[5]) & ym2612.OPN.pan[10]);
-    rt += ((out_fm[5]) & ym2612.OPN.pan[11]);
-
-    /* buffering */
-    *buffer++ = lt;
-    *buffer++ = rt;
+    mix_output(buffer, pan_l, pan_r, config_ym2612_clip);
+    buffer += 2;
 
     /* CSM mode: if CSM Key ON has occured, CSM Key OFF need to be sent       */
     /* only if Timer A does not overflow again (i.e CSM Key ON not set again) */
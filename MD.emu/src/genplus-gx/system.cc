@@ -461,7 +461,7 @@ static void system_frame_md(EmuEx::EmuSystemTaskContext taskCtx, EmuEx::EmuVideo
   /* parse first line of sprites */
   if (reg[1] & 0x40)
   {
-    parse_satb(-1);
+    render_parse_satb(-1);
   }
 
   /* run 68k & Z80 */
@@ -494,6 +494,9 @@ static void system_frame_md(EmuEx::EmuSystemTaskContext taskCtx, EmuEx::EmuVideo
   /* Active Display */
   do
   {
+    /* wait for previous scanline if rendering on another thread */
+    render_sync();
+
     /* update V Counter */
     v_counter = line;
 
@@ -527,7 +530,7 @@ static void system_frame_md(EmuEx::EmuSystemTaskContext taskCtx, EmuEx::EmuVideo
     /* render scanline */
     if (!do_skip)
     {
-      render_line(line, pixmap);
+      render_line_async(line, pixmap);
     }
 
     /* run 68k & Z80 */
@@ -559,6 +562,8 @@ static void system_frame_md(EmuEx::EmuSystemTaskContext taskCtx, EmuEx::EmuVideo
   }
   while (++line < bitmap.viewport.h);
 
+  render_sync();
+
   if(emuVideo)
   {
   	emuVideo->startFrameWithAltFormat(taskCtx, pixmap);
@@ -867,7 +872,7 @@ static void system_frame_sms(EmuEx::EmuSystemTaskContext taskCtx, EmuEx::EmuVide
   /* parse first line of sprites */
   if (reg[1] & 0x40)
   {
-    parse_satb(-1);
+    render_parse_satb(-1);
   }
 
   /* latch Horizontal Scroll register (if modified during VBLANK) */
@@ -205,6 +205,9 @@ void vdp_init(void)
 
 void vdp_reset(void)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   memset ((char *) sat.b, 0, sizeof (sat));
   memset ((char *) vram.b, 0, sizeof (vram));
   memset ((char *) cram.b, 0, sizeof (cram));
@@ -311,6 +314,9 @@ void vdp_reset(void)
 
 int vdp_context_save(uint8 *state)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
 	//logMsg("saving VDP context");
   int bufferptr = 0;
 
@@ -339,6 +345,9 @@ int vdp_context_save(uint8 *state)
 
 int vdp_context_load(uint8 *state)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
 	//logMsg("loading VDP context");
   int i, bufferptr = 0;
   uint8 temp_reg[0x20];
@@ -417,6 +426,9 @@ int vdp_context_load(uint8 *state)
 
 void vdp_dma_update(unsigned int cycles)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   int dma_cycles;
 
   /* DMA transfer rate (bytes per line)
@@ -555,6 +567,9 @@ void vdp_dma_update(unsigned int cycles)
 
 void vdp_68k_ctrl_w(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Check pending flag */
   if (pending == 0)
   {
@@ -697,6 +712,9 @@ void vdp_68k_ctrl_w(unsigned int data)
 
 void vdp_z80_ctrl_w(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   switch (pending)
   {
     case 0:
@@ -828,6 +846,9 @@ void vdp_z80_ctrl_w(unsigned int data)
  */
 unsigned int vdp_68k_ctrl_r(unsigned int cycles)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Update FIFO flags */
   vdp_fifo_update(cycles);
 
@@ -886,6 +907,9 @@ unsigned int vdp_68k_ctrl_r(unsigned int cycles)
 
 unsigned int vdp_z80_ctrl_r(unsigned int cycles)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Update DMA Busy flag (Mega Drive VDP specific) */
   if (/*(system_hw & SYSTEM_MD) &&*/ (status & 2) && !dma_length && (cycles >= dma_endCycles))
   {
@@ -1841,6 +1865,9 @@ static void vdp_bus_w(unsigned int data)
 
 static void vdp_68k_data_w_m4(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -1930,6 +1957,9 @@ static void vdp_68k_data_w_m4(unsigned int data)
 
 static void vdp_68k_data_w_m5(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2065,6 +2095,9 @@ static unsigned int vdp_68k_data_r_m5(void)
 
 static void vdp_z80_data_w_m4(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2116,6 +2149,9 @@ static void vdp_z80_data_w_m4(unsigned int data)
 
 static void vdp_z80_data_w_m5(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2295,6 +2331,9 @@ static unsigned int vdp_z80_data_r_m5(void)
 #if 0
 static void vdp_z80_data_w_ms(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2360,6 +2399,9 @@ static void vdp_z80_data_w_ms(unsigned int data)
 
 static void vdp_z80_data_w_gg(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2433,6 +2475,9 @@ static void vdp_z80_data_w_gg(unsigned int data)
 
 static void vdp_z80_data_w_sg(unsigned int data)
 {
+  /* VDP state may change, finish any queued line first */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -24,6 +24,9 @@
 #include "shared.h"
 #include "vdp_render.h"
 #include <imagine/pixmap/Pixmap.hh>
+#include <imagine/thread/Semaphore.hh>
+#include <imagine/logger/logger.h>
+#include <thread>
 
 #ifdef NGC
 #include "md_ntsc.h"
@@ -404,7 +407,7 @@ static __inline__ void WRITE_LONG(void *address, uint32 data)
     { \
       temp |= (lb[i] << 8); \
       lb[i] = TABLE[temp | ATTR]; \
-      status |= ((temp & 0x8000) >> 10); \
+      spr_status |= ((temp & 0x8000) >> 10); \
     } \
   }
 
@@ -416,10 +419,10 @@ static __inline__ void WRITE_LONG(void *address, uint32 data)
     { \
       temp |= (lb[i] << 8); \
       lb[i] = TABLE[temp | ATTR]; \
-      if ((temp & 0x8000) && !(status & 0x20)) \
+      if ((temp & 0x8000) && !(spr_status & 0x20)) \
       { \
         spr_col = (v_counter << 8) | ((xpos + i + 13) >> 1); \
-        status |= 0x20; \
+        spr_status |= 0x20; \
       } \
     } \
   }
@@ -432,18 +435,18 @@ static __inline__ void WRITE_LONG(void *address, uint32 data)
     { \
       temp |= (lb[i] << 8); \
       lb[i] = TABLE[temp | ATTR]; \
-      if ((temp & 0x8000) && !(status & 0x20)) \
+      if ((temp & 0x8000) && !(spr_status & 0x20)) \
       { \
         spr_col = (v_counter << 8) | ((xpos + i + 13) >> 1); \
-        status |= 0x20; \
+        spr_status |= 0x20; \
       } \
       temp &= 0x00FF; \
       temp |= (lb[i+1] << 8); \
       lb[i+1] = TABLE[temp | ATTR]; \
-      if ((temp & 0x8000) && !(status & 0x20)) \
+      if ((temp & 0x8000) && !(spr_status & 0x20)) \
       { \
         spr_col = (v_counter << 8) | ((xpos + i + 1 + 13) >> 1); \
-        status |= 0x20; \
+        spr_status |= 0x20; \
       } \
     } \
   }
@@ -520,6 +523,56 @@ uint8 object_count;
 /* Sprite Collision Info */
 uint16 spr_col;
 
+/* Sprite overflow & collision status flags set while rendering the current line,
+   merged back into the VDP status register once the line is done */
+static uint16 spr_status;
+
+/* Render thread */
+bool render_line_pending;
+
+static void render_line_direct(int line, IG::MutablePixmapView pix);
+
+static struct RenderThread
+{
+  std::thread thread;
+  std::binary_semaphore lineSem{0}, lineDoneSem{0};
+  IG::MutablePixmapView pix;
+  int line;
+  bool quit;
+
+  ~RenderThread() { stop(); }
+
+  void start()
+  {
+    if (thread.joinable())
+      return;
+    quit = false;
+    thread = std::thread{[this]()
+    {
+      logMsg("starting VDP render thread");
+      for (;;)
+      {
+        lineSem.acquire();
+        if (quit)
+          return;
+        render_line_direct(line, pix);
+        lineDoneSem.release();
+      }
+    }};
+  }
+
+  void stop()
+  {
+    if (!thread.joinable())
+      return;
+    render_sync();
+    quit = true;
+    lineSem.release();
+    thread.join();
+    logMsg("stopped VDP render thread");
+  }
+} renderThread;
+
 /* Function pointers */
 void (*render_bg)(int line, int width);
 void (*render_obj)(int max_width);
@@ -2829,7 +2882,7 @@ void render_obj_m4(int max_width)
   }
 
   /* Set SOVR flag */
-  status |= spr_ovr;
+  spr_status |= spr_ovr;
   spr_ovr = 0;
 
   /* Draw sprites in front-to-back order */
@@ -3458,7 +3511,7 @@ void parse_satb_m5(int line)
       /* Sprite overflow */
       if(count == max)
       {
-        status |= 0x40;
+        spr_status |= 0x40;
         break;
       }
 
@@ -3688,6 +3741,8 @@ void render_init(void)
 
 void render_reset(void)
 {
+  render_sync();
+
   /* Clear line buffers */
   memset(linebuf, 0, sizeof(linebuf));
 
@@ -3703,7 +3758,7 @@ void render_reset(void)
 /* Line rendering functions                                                 */
 /*--------------------------------------------------------------------------*/
 
-void render_line(int line, IG::MutablePixmapView pix)
+static void render_line_direct(int line, IG::MutablePixmapView pix)
 {
   int width = bitmap.viewport.w;
 
@@ -3754,8 +3809,58 @@ void render_line(int line, IG::MutablePixmapView pix)
   	remap_line(line, pix);
 }
 
+void render_line(int line, IG::MutablePixmapView pix)
+{
+  render_sync();
+  spr_status = status & 0x60;
+  render_line_direct(line, pix);
+  status |= spr_status;
+}
+
+void render_parse_satb(int line)
+{
+  render_sync();
+  spr_status = status & 0x60;
+  parse_satb(line);
+  status |= spr_status;
+}
+
+void render_line_async(int line, IG::MutablePixmapView pix)
+{
+  if (!renderThread.thread.joinable())
+  {
+    render_line(line, pix);
+    return;
+  }
+
+  /* Line is rendered from the current VDP state, any access that could modify it
+     must call render_sync() first so register changes stay ordered */
+  render_sync();
+  spr_status = status & 0x60;
+  renderThread.line = line;
+  renderThread.pix = pix;
+  render_line_pending = true;
+  renderThread.lineSem.release();
+}
+
+void render_wait(void)
+{
+  renderThread.lineDoneSem.acquire();
+  render_line_pending = false;
+  status |= spr_status;
+}
+
+void render_set_threaded(bool on)
+{
+  if (on)
+    renderThread.start();
+  else
+    renderThread.stop();
+}
+
 void blank_line(int line, int offset, int width)
 {
+  render_sync();
   memset(&linebuf[0][0x20 + offset], 0x40, width);
   //remap_line(line);
 }
@@ -3801,6 +3906,7 @@ void setFramebufferRenderFormat(IG::PixelFormat fmt)
 {
 	if(!isValidPixelFormat(fmt))
 		return;
+	render_sync();
 	fbRenderFormat = fmt;
 	palette_init();
 }
@@ -33,11 +33,16 @@ using Pixel = std::conditional_t<RENDER_BPP == 32, uint32_t, uint16_t>;
 /* Global variables */
 extern uint8 object_count;
 extern uint16 spr_col;
+extern bool render_line_pending;
 
 /* Function prototypes */
 extern void render_init(void);
 extern void render_reset(void);
 extern void render_line(int line, IG::MutablePixmapView pix);
+extern void render_line_async(int line, IG::MutablePixmapView pix);
+extern void render_wait(void);
+extern void render_parse_satb(int line);
+extern void render_set_threaded(bool on);
 extern void blank_line(int line, int offset, int width);
 extern void remap_line(int line, IG::MutablePixmapView pix);
 extern void remapPixmap(IG::MutablePixmapView dest, IG::PixmapView src);
@@ -63,6 +68,13 @@ IG::PixelFormat framebufferRenderFormat();
 IG::MutablePixmapView framebufferPixmap();
 IG::MutablePixmapView framebufferRenderFormatPixmap();
 
+/* Wait for any line queued by render_line_async() to finish */
+static inline void render_sync(void)
+{
+  if (render_line_pending)
+    render_wait();
+}
+
 /* Function pointers */
 extern void (*render_bg)(int line, int width);
 extern void (*render_obj)(int max_width);
@@ -331,6 +331,8 @@ void applyCheats()
       e.setApplied(1);
     }
   }
+  if(emuSystemIs16Bit())
+  	m68k_flush_code_cache(mm68k);
   if(romCheatList.size() || ramCheatList.size())
   {
   	logMsg("%zu RAM cheats, %zu ROM cheats active", ramCheatList.size(), romCheatList.size());
@@ -373,6 +375,8 @@ void clearCheats()
       e.setApplied(0);
     }
   }
+  if(emuSystemIs16Bit())
+  	m68k_flush_code_cache(mm68k);
   logMsg("done");
 }
 
@@ -27,6 +27,7 @@
 #include "input.h"
 #include "io_ctrl.h"
 #include "vdp_ctrl.h"
+#include "vdp_render.h"
 
 namespace EmuEx
 {
@@ -263,11 +264,23 @@ class CustomSystemOptionView : public SystemOptionView, public MainAppHelper<Cus
 		}
 	};
 
+	BoolMenuItem renderThread
+	{
+		"Render Video On Separate Thread", &defaultFace(),
+		(bool)system().optionRenderThread,
+		[this](BoolMenuItem &item)
+		{
+			system().optionRenderThread = item.flipBoolValue(*this);
+			render_set_threaded(system().optionRenderThread);
+		}
+	};
+
 public:
 	CustomSystemOptionView(ViewAttachParams attach): SystemOptionView{attach, true}
 	{
 		loadStockItems();
 		item.emplace_back(&bigEndianSram);
+		item.emplace_back(&renderThread);
 	}
 };
 
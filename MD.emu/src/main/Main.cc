@@ -99,12 +99,16 @@ void MdSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio
 	RAMCheatUpdate();
 	system_frame(taskCtx, video);
 
-	int16 audioBuff[snd.buffer_size * 2];
-	int frames = audio_update(audioBuff);
 	if(audio)
 	{
+		int frames = audio_update((int16*)audio->frameWriteBuffer(snd.buffer_size));
 		//logMsg("%d frames", frames);
-		audio->writeFrames(audioBuff, frames);
+		audio->commitFrames(frames);
+	}
+	else
+	{
+		int16 audioBuff[snd.buffer_size * 2];
+		audio_update(audioBuff);
 	}
 	//logMsg("frame end");
 }
@@ -300,6 +304,24 @@ void MdSystem::closeSystem()
 	clearCheatList();
 }
 
+void MdSystem::addMemoryUsage(MemoryUsageReport &report) const
+{
+	report.add("ROM", sizeof(cart.rom));
+	report.add("68K/Z80 RAM", sizeof(work_ram) + sizeof(zram));
+	report.add("VDP Pattern Cache", sizeof(bg_pattern_cache));
+	if(mm68k.codeCache)
+		report.add("68K Code Cache", sizeof(M68KCodeCache));
+	#ifndef NO_SCD
+	if(sCD.isActive)
+		report.add("Sega CD", sizeof(sCD));
+	#endif
+}
+
+void MdSystem::freeCaches()
+{
+	m68k_free_code_cache(mm68k);
+}
+
 static unsigned detectISORegion(uint8 bootSector[0x800])
 {
 	auto bootByte = bootSector[0x20b];
@@ -25,6 +25,7 @@ enum
 	CFGKEY_MD_REGION = 284, CFGKEY_VIDEO_SYSTEM = 285,
 	CFGKEY_INPUT_PORT_1 = 286, CFGKEY_INPUT_PORT_2 = 287,
 	CFGKEY_MULTITAP = 288, CFGKEY_CHEATS_PATH = 289,
+	CFGKEY_RENDER_THREAD = 290,
 };
 
 bool hasMDExtension(std::string_view name);
@@ -46,6 +47,7 @@ public:
 	SByte1Option optionInputPort2{CFGKEY_INPUT_PORT_2, -1, false, optionIsValidWithMinMax<-1, 4>};
 	Byte1Option optionRegion{CFGKEY_MD_REGION, 0, false, optionIsValidWithMax<4>};
 	Byte1Option optionVideoSystem{CFGKEY_VIDEO_SYSTEM, 0, false, optionIsValidWithMax<2>};
+	Byte1Option optionRenderThread{CFGKEY_RENDER_THREAD, 0};
 	#ifndef NO_SCD
 	FS::PathString cdBiosUSAPath{}, cdBiosJpnPath{}, cdBiosEurPath{};
 	#endif
@@ -88,6 +90,8 @@ public:
 		Input::DragTrackerState prevDragState, IG::WindowRect gameRect);
 	bool onPointerInputEnd(const Input::MotionEvent &, Input::DragTrackerState, IG::WindowRect gameRect);
 	VideoSystem videoSystem() const;
+	void addMemoryUsage(MemoryUsageReport &) const;
+	void freeCaches();
 
 private:
 	void setupSmsInput(EmuApp &);
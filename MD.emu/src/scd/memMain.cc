@@ -281,9 +281,11 @@ void mainGateWrite8(unsigned address, unsigned data)
 			}
 			case 6: //logMsg("write h-int 1");
 				cart.rom[0x72 + 1] = data;
+				m68k_flush_code_cache(mm68k);
 				break;
 			case 7: //logMsg("write h-int 2");
 				cart.rom[0x72] = data;
+				m68k_flush_code_cache(mm68k);
 				break;
 			case 0xf:
 				writeMComFlags((data << 1) | ((data >> 7) & 1)); // rol8 1 (special case)
@@ -31,6 +31,7 @@
 #include "ArchMidi.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 #include <assert.h>
 
@@ -117,6 +118,7 @@ struct Mixer
     UInt32 index;
     UInt32 volIndex;
     Int16   buffer[AUDIO_STEREO_BUFFER_SIZE];
+    Int32   mixBuffer[AUDIO_STEREO_BUFFER_SIZE];
     AudioTypeInfo audioTypeInfo[MIXER_CHANNEL_TYPE_COUNT];
     MixerChannel channels[MAX_CHANNELS];
     MixerChannel midi; // This channel is only used for meter output
@@ -134,6 +136,7 @@ struct Mixer
     Int32   volCntRight;
     //FILE*   file;
     int     enable;
+    int     meters;
 };
 
 
@@ -463,13 +466,136 @@ static void flushMixerSamples(Mixer* mixer, Int16* buffer)
     }
 }
 
+static void mixChannelStereo(Int32* restrict acc, const Int32* restrict src, UInt32 count,
+                             Int32 volumeLeft, Int32 volumeRight, Int32 stereo)
+{
+    UInt32 j;
+
+    if (stereo) {
+        for (j = 0; j < count; j++) {
+            acc[2 * j]     += volumeLeft  * src[2 * j];
+            acc[2 * j + 1] += volumeRight * src[2 * j + 1];
+        }
+    }
+    else {
+        for (j = 0; j < count; j++) {
+            acc[2 * j]     += volumeLeft  * src[j];
+            acc[2 * j + 1] += volumeRight * src[j];
+        }
+    }
+}
+
+static void mixChannelMono(Int32* restrict acc, const Int32* restrict src, UInt32 count,
+                           Int32 volume, Int32 stereo)
+{
+    UInt32 j;
+
+    if (stereo) {
+        for (j = 0; j < count; j++) {
+            acc[j] += volume * (src[2 * j] + src[2 * j + 1]) / 2;
+        }
+    }
+    else {
+        for (j = 0; j < count; j++) {
+            acc[j] += volume * src[j];
+        }
+    }
+}
+
+static void meterChannel(Mixer* mixer, MixerChannel* channel, const Int32* src, UInt32 count)
+{
+    UInt32 j;
+
+    for (j = 0; j < count; j++) {
+        Int32 chanLeft;
+        Int32 chanRight;
+
+        if (!mixer->stereo) {
+            chanLeft  = channel->stereo ?
+                        channel->volumeLeft * (src[2 * j] + src[2 * j + 1]) / 2 :
+                        channel->volumeLeft * src[j];
+            chanRight = chanLeft;
+        }
+        else if (channel->stereo) {
+            chanLeft  = channel->volumeLeft  * src[2 * j];
+            chanRight = channel->volumeRight * src[2 * j + 1];
+        }
+        else {
+            chanLeft  = channel->volumeLeft  * src[j];
+            chanRight = channel->volumeRight * src[j];
+        }
+
+        channel->volCntLeft  += (chanLeft  > 0 ? chanLeft  : -chanLeft)  / 2048;
+        channel->volCntRight += (chanRight > 0 ? chanRight : -chanRight) / 2048;
+    }
+}
+
+static void updateMeters(Mixer* mixer, Int32* chBuff[])
+{
+    int i;
+
+    if (mixer->volIndex < 441) {
+        return;
+    }
+
+    Int32 newVolumeLeft  = mixer->volCntLeft  / mixer->volIndex / 164;
+    Int32 newVolumeRight = mixer->volCntRight / mixer->volIndex / 164;
+
+    if (newVolumeLeft > 100) {
+        newVolumeLeft = 100;
+    }
+    if (newVolumeLeft > mixer->volIntLeft) {
+        mixer->volIntLeft  = newVolumeLeft;
+    }
+
+    if (newVolumeRight > 100) {
+        newVolumeRight = 100;
+    }
+    if (newVolumeRight > mixer->volIntRight) {
+        mixer->volIntRight  = newVolumeRight;
+    }
+
+    mixer->volCntLeft  = 0;
+    mixer->volCntRight = 0;
+
+    for (i = 0; i < mixer->channelCount; i++) {
+        Int32 newVolumeLeft  = (Int32)(mixer->channels[i].volCntLeft  / /*mixer->masterVolume /*/ mixer->volIndex / 328);
+        Int32 newVolumeRight = (Int32)(mixer->channels[i].volCntRight / /*mixer->masterVolume /*/ mixer->volIndex / 328);
+
+        if (newVolumeLeft > 100) {
+            newVolumeLeft = 100;
+        }
+        if (newVolumeLeft > mixer->channels[i].volIntLeft) {
+            mixer->channels[i].volIntLeft  = newVolumeLeft;
+        }
+
+        if (newVolumeRight > 100) {
+            newVolumeRight = 100;
+        }
+        if (newVolumeRight > mixer->channels[i].volIntRight) {
+            mixer->channels[i].volIntRight  = newVolumeRight;
+        }
+
+        mixer->channels[i].volCntLeft  = 0;
+        mixer->channels[i].volCntRight = 0;
+
+        if (chBuff[i] && chBuff[i][0]) {
+            mixer->channels[i].active++;
+        }
+    }
+    mixer->volIndex = 0;
+}
+
 void mixerSync(Mixer* mixer)
 {
     UInt32 systemTime = boardSystemTime();
-    Int16* buffer   = mixer->buffer;
+    Int16* buffer   = mixer->buffer + mixer->index;
+    Int32* acc      = mixer->mixBuffer;
     Int32* chBuff[MAX_CHANNELS];
     UInt32 count;
+    UInt32 samples;
     UInt64 elapsed;
+    UInt32 j;
     int i;
 
     elapsed        = mixer->rate * (UInt64)(systemTime - mixer->refTime) + mixer->refFrag;
@@ -482,17 +608,12 @@ void mixerSync(Mixer* mixer)
         return;
     }
 
+    samples = mixer->stereo ? count * 2 : count;
+
     if (!mixer->enable) {
-        while (count--) {
-            if (mixer->stereo) {
-                buffer[mixer->index++] = 0;
-                buffer[mixer->index++] = 0;
-            }
-            else {
-                buffer[mixer->index++] = 0;
-            }
-        }
-        flushMixerSamples(mixer, buffer);
+        memset(buffer, 0, samples * sizeof(Int16));
+        mixer->index += samples;
+        flushMixerSamples(mixer, mixer->buffer);
         return;
     }
     
@@ -505,143 +626,64 @@ void mixerSync(Mixer* mixer)
         }
     }
 
-    if (mixer->stereo) {
-        while (count--) {
-            Int32 left = 0;
-            Int32 right = 0;
-
-            for (i = 0; i < mixer->channelCount; i++) {
-                Int32 chanLeft;
-                Int32 chanRight;
-
-                if (chBuff[i] == NULL) {
-                    continue;
-                }
-
-                if (mixer->channels[i].stereo) {
-                    chanLeft = mixer->channels[i].volumeLeft * *chBuff[i]++;
-                    chanRight = mixer->channels[i].volumeRight * *chBuff[i]++;
-                }
-                else {
-                    Int32 tmp = *chBuff[i]++;
-                    chanLeft = mixer->channels[i].volumeLeft * tmp;
-                    chanRight = mixer->channels[i].volumeRight * tmp;
-                }
-
-                mixer->channels[i].volCntLeft  += (chanLeft  > 0 ? chanLeft  : -chanLeft)  / 2048;
-                mixer->channels[i].volCntRight += (chanRight > 0 ? chanRight : -chanRight) / 2048;
-
-                left  += chanLeft;
-                right += chanRight;
-            }
-
-            left  /= 4096;
-            right /= 4096;
+    // Accumulate each channel's whole block, then scale and saturate once
+    memset(acc, 0, samples * sizeof(Int32));
 
-            mixer->volCntLeft  += left  > 0 ? left  : -left;
-            mixer->volCntRight += right > 0 ? right : -right;
+    for (i = 0; i < mixer->channelCount; i++) {
+        MixerChannel* channel = mixer->channels + i;
 
-            if (left  >  32767) { left  = 32767; }
-            if (left  < -32767) { left  = -32767; }
-            if (right >  32767) { right = 32767; }
-            if (right < -32767) { right = -32767; }
+        if (chBuff[i] == NULL) {
+            continue;
+        }
 
-            buffer[mixer->index++] = (Int16)left;
-            buffer[mixer->index++] = (Int16)right;
+        if (mixer->stereo) {
+            mixChannelStereo(acc, chBuff[i], count, channel->volumeLeft, channel->volumeRight, channel->stereo);
+        }
+        else {
+            mixChannelMono(acc, chBuff[i], count, channel->volumeLeft, channel->stereo);
+        }
 
-            mixer->volIndex++;
+        if (mixer->meters) {
+            meterChannel(mixer, channel, chBuff[i], count);
         }
     }
-    else {
-        while (count--) {
-            Int32 left = 0;
-
-            for (i = 0; i < mixer->channelCount; i++) {
-                Int32 chanLeft;
-
-                if (chBuff[i] == NULL) {
-                    continue;
-                }
-
-                if (mixer->channels[i].stereo) {
-                    Int32 tmp = *chBuff[i]++;
-                    chanLeft = mixer->channels[i].volumeLeft * (tmp + *chBuff[i]++) / 2;
-                }
-                else {
-                    chanLeft = mixer->channels[i].volumeLeft * *chBuff[i]++;
-                }
-            
-                mixer->channels[i].volCntLeft  += (chanLeft > 0 ? chanLeft : -chanLeft) / 2048;
-                mixer->channels[i].volCntRight += (chanLeft > 0 ? chanLeft : -chanLeft) / 2048;
-                left  += chanLeft;
-            }
-
-            left  /= 4096;
-
-            mixer->volCntLeft  += left > 0 ? left : -left;
-            mixer->volCntRight += left > 0 ? left : -left;
 
-            if (left  >  32767) left  = 32767;
-            if (left  < -32767) left  = -32767;
+    for (j = 0; j < samples; j++) {
+        Int32 sample = acc[j] / 4096;
 
-            buffer[mixer->index++] = (Int16)left;
+        if (sample >  32767) sample =  32767;
+        if (sample < -32767) sample = -32767;
 
-            mixer->volIndex++;
-        }
+        buffer[j] = (Int16)sample;
     }
 
-    flushMixerSamples(mixer, buffer);
-
-    if (mixer->volIndex >= 441) {
-        Int32 newVolumeLeft  = mixer->volCntLeft  / mixer->volIndex / 164;
-        Int32 newVolumeRight = mixer->volCntRight / mixer->volIndex / 164;
-    
-        if (newVolumeLeft > 100) {
-            newVolumeLeft = 100;
-        }
-        if (newVolumeLeft > mixer->volIntLeft) {
-            mixer->volIntLeft  = newVolumeLeft;
-        }
+    if (mixer->meters) {
+        for (j = 0; j < count; j++) {
+            Int32 left  = mixer->stereo ? acc[2 * j]     / 4096 : acc[j] / 4096;
+            Int32 right = mixer->stereo ? acc[2 * j + 1] / 4096 : left;
 
-        if (newVolumeRight > 100) {
-            newVolumeRight = 100;
-        }
-        if (newVolumeRight > mixer->volIntRight) {
-            mixer->volIntRight  = newVolumeRight;
+            mixer->volCntLeft  += left  > 0 ? left  : -left;
+            mixer->volCntRight += right > 0 ? right : -right;
         }
+        mixer->volIndex += count;
+    }
 
-        mixer->volCntLeft  = 0;
-        mixer->volCntRight = 0;
-
-        for (i = 0; i < mixer->channelCount; i++) {
-            Int32 newVolumeLeft  = (Int32)(mixer->channels[i].volCntLeft  / /*mixer->masterVolume /*/ mixer->volIndex / 328);
-            Int32 newVolumeRight = (Int32)(mixer->channels[i].volCntRight / /*mixer->masterVolume /*/ mixer->volIndex / 328);
-
-            if (newVolumeLeft > 100) {
-                newVolumeLeft = 100;
-            }
-            if (newVolumeLeft > mixer->channels[i].volIntLeft) {
-                mixer->channels[i].volIntLeft  = newVolumeLeft;
-            }
-
-            if (newVolumeRight > 100) {
-                newVolumeRight = 100;
-            }
-            if (newVolumeRight > mixer->channels[i].volIntRight) {
-                mixer->channels[i].volIntRight  = newVolumeRight;
-            }
-
-            mixer->channels[i].volCntLeft  = 0;
-            mixer->channels[i].volCntRight = 0;
+    mixer->index += samples;
+    flushMixerSamples(mixer, mixer->buffer);
 
-            if (chBuff[i] && chBuff[i][0]) {
-                mixer->channels[i].active++;
-            }
-        }
-        mixer->volIndex = 0;
+    if (mixer->meters) {
+        updateMeters(mixer, chBuff);
     }
 }
 
+void mixerSetVolumeMeters(Mixer* mixer, int enable)
+{
+    mixer->meters = enable;
+    mixer->volIndex = 0;
+    mixer->volCntLeft = 0;
+    mixer->volCntRight = 0;
+}
+
 /*void mixerStartLog(Mixer* mixer, char* fileName)
 {
     if (mixer->logging == 1) {
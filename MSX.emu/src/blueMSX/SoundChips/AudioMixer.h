@@ -98,6 +98,8 @@ Int32 mixerRegisterChannel(Mixer* mixer, Int32 audioType, Int32 stereo,
                            MixerUpdateCallback callback, MixerSetSampleRateCallback rateCallback,
                            void*param);
 void mixerSetEnable(Mixer* mixer, int enable);
+/* Volume meter and channel activity tracking, off by default */
+void mixerSetVolumeMeters(Mixer* mixer, int enable);
 void mixerUnregisterChannel(Mixer* mixer, Int32 handle);
 
 void mixerSetBoardFrequency(int CPUFrequency);
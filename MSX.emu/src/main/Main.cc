@@ -721,13 +721,21 @@ void MsxSystem::renderFramebuffer(EmuVideo &video)
 }
 
 void MsxSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio)
+{
+	runFrames(taskCtx, video, audio, 1);
+}
+
+void MsxSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
 {
 	emuSysTask = taskCtx;
-	emuVideo = video;
 	mixerSetWriteCallback(mixer, audio ? soundWrite : nullptr, audio, 0);
-	boardInfo.run(boardInfo.cpuRef);
-	((R800*)boardInfo.cpuRef)->terminate = 0;
-	commitUnchangedVideoFrame(); // runs if emuVideo wasn't unset in emulation of this frame
+	for(auto i : iotaCount(frames))
+	{
+		emuVideo = i == frames - 1 ? video : nullptr;
+		boardInfo.run(boardInfo.cpuRef);
+		((R800*)boardInfo.cpuRef)->terminate = 0;
+	}
+	commitUnchangedVideoFrame(); // runs if emuVideo wasn't unset in emulation of the last frame
 }
 
 bool MsxSystem::shouldFastForward() const
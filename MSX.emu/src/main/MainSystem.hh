@@ -79,6 +79,7 @@ public:
 	// required API functions
 	void loadContent(IO &, EmuSystemCreateParams, OnLoadProgressDelegate);
 	[[gnu::hot]] void runFrame(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *audio);
+	[[gnu::hot]] void runFrames(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *audio, int frames);
 	FS::FileString stateFilename(int slot, std::string_view name) const;
 	std::string_view stateFilenameExt() const { return ".sta"; }
 	void loadState(EmuApp &, CStringView uri);
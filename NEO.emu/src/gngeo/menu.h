@@ -73,6 +73,11 @@ enum { PBAR_ACTION_LOADROM, PBAR_ACTION_DECRYPT, PBAR_ACTION_LOADGNO, PBAR_ACTIO
 void gn_init_pbar(unsigned action,int size);
 void gn_update_pbar(int pos);
 void gn_terminate_pbar(void);
+typedef void (*gn_parallel_func)(void *data, unsigned start, unsigned end);
+/* Runs each of the passes funcs over [0, count) in order, split into chunks across all CPU cores
+   with the same worker threads used for every pass. Progress is reported through gn_update_pbar()
+   as pass * count + items done, returns when all passes finish */
+void gn_parallel_for(const gn_parallel_func *funcs, unsigned passes, void *data, unsigned count);
 
 void gn_popup_error(char *name,char *fmt,...);
 int gn_popup_question(char *name,char *fmt,...);
@@ -534,35 +534,39 @@ static void decrypt(UINT8 *r0, UINT8 *r1,
 #include <stdio.h>
 
 
-static void neogeo_gfx_decrypt(running_machine *machine, int extra_xor)
-{
+typedef struct gfx_decrypt_ctx {
 	UINT8 *buf;
 	UINT8 *rom;
-	unsigned rpos;
-	const unsigned rom_size = memory_region_length(machine, "sprites");
-
-	buf = alloc_array_or_die(UINT8, rom_size);
+	unsigned rom_size;
+	int extra_xor;
+} gfx_decrypt_ctx;
 
-	rom = memory_region(machine, "sprites");
-	const unsigned pbarUpdateCount = 20;
-	const unsigned pbarSteps = (rom_size/4)/pbarUpdateCount;
-	gn_init_pbar(PBAR_ACTION_DECRYPT, rom_size/2);
-	// Data xor
-	for (rpos = 0;rpos < rom_size/4;rpos++)
+// Each pass only reads from one buffer and writes to the other, so any
+// split of the rpos range can run concurrently
+static void gfx_decrypt_data_xor(void *data, unsigned start, unsigned end)
+{
+	gfx_decrypt_ctx *ctx = (gfx_decrypt_ctx*)data;
+	UINT8 *buf = ctx->buf;
+	const UINT8 *rom = ctx->rom;
+	unsigned rpos;
+	for (rpos = start;rpos < end;rpos++)
 	{
 		decrypt(buf+4*rpos+0, buf+4*rpos+3, rom[4*rpos+0], rom[4*rpos+3], type0_t03, type0_t12, type1_t03, rpos, (rpos>>8) & 1);
 		decrypt(buf+4*rpos+1, buf+4*rpos+2, rom[4*rpos+1], rom[4*rpos+2], type0_t12, type0_t03, type1_t12, rpos, ((rpos>>16) ^ address_16_23_xor2[(rpos>>8) & 0xff]) & 1);
-		if (rpos % pbarSteps == 0) {
-			gn_update_pbar(rpos);
-		}
 	}
-	// Address xor
-	for (rpos = 0;rpos < rom_size/4;rpos++)
+}
+
+static void gfx_decrypt_address_xor(void *data, unsigned start, unsigned end)
+{
+	gfx_decrypt_ctx *ctx = (gfx_decrypt_ctx*)data;
+	const UINT8 *buf = ctx->buf;
+	UINT8 *rom = ctx->rom;
+	const unsigned rom_size = ctx->rom_size;
+	const int extra_xor = ctx->extra_xor;
+	unsigned rpos;
+	for (rpos = start;rpos < end;rpos++)
 	{
 		int baser;
-		if (rpos % pbarSteps == 0) {
-			gn_update_pbar(rpos + (rom_size >> 2));
-		}
 		baser = rpos;
 
 		baser ^= extra_xor;
@@ -596,8 +600,24 @@ static void neogeo_gfx_decrypt(running_machine *machine, int extra_xor)
 		rom[4*rpos+2] = buf[4*baser+2];
 		rom[4*rpos+3] = buf[4*baser+3];
 	}
+}
+
+static void neogeo_gfx_decrypt(running_machine *machine, int extra_xor)
+{
+	gfx_decrypt_ctx ctx;
+	const unsigned rom_size = memory_region_length(machine, "sprites");
+	const unsigned words = rom_size/4;
+	// data xor pass, then address xor pass reading its output
+	static const gn_parallel_func passes[] = {gfx_decrypt_data_xor, gfx_decrypt_address_xor};
+
+	ctx.buf = alloc_array_or_die(UINT8, rom_size);
+	ctx.rom = memory_region(machine, "sprites");
+	ctx.rom_size = rom_size;
+	ctx.extra_xor = extra_xor;
+	gn_init_pbar(PBAR_ACTION_DECRYPT, rom_size/2);
+	gn_parallel_for(passes, 2, &ctx, words);
 	gn_terminate_pbar();
-	free(buf);
+	free(ctx.buf);
 }
 
 
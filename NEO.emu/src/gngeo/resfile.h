@@ -7,6 +7,8 @@
 ROM_DEF *res_load_drv(void *contextPtr, const char *name);
 //SDL_Surface *res_load_bmp(char *bmp);
 void *res_load_data(void *contextPtr, const char *name);
+Uint8 *res_map_file_region(void *contextPtr, const char *filename, Uint32 offset, Uint32 size);
+void res_unmap_file_regions(void);
 //SDL_Surface *res_load_stbi(char *bmp);
 
 #endif
@@ -1525,8 +1525,15 @@ int dr_load_game(void *contextPtr, char *name, char romerror[1024]) {
 
 }
 
+static int tiles_mapped = 0; /* sprite tiles point into a mapped .gno file */
+
 #if defined(HAVE_LIBZ)//&& defined (HAVE_MMAP)
 
+/* Uncompressed (type 2) regions start on a page boundary so they can be
+ * memory mapped straight from the file */
+#define GNO_PAGE_SIZE 4096
+#define GNO_PAGE_ALIGN(pos) (((pos) + GNO_PAGE_SIZE - 1) & ~(GNO_PAGE_SIZE - 1))
+
 static int dump_region(FILE *gno, const ROM_REGION *rom, Uint8 id, Uint8 type,
 		Uint32 block_size, unsigned verbose) {
 	if (rom->p == NULL)
@@ -1537,6 +1544,10 @@ static int dump_region(FILE *gno, const ROM_REGION *rom, Uint8 id, Uint8 type,
 	if (type == 0) {
 		if(verbose) logMsg("Dump %d %08x", id, rom->size);
 		fwrite(rom->p, rom->size, 1, gno);
+	} else if (type == 2) {
+		if(verbose) logMsg("Dump mappable %d %08x", id, rom->size);
+		fseek(gno, GNO_PAGE_ALIGN(ftell(gno)), SEEK_SET);
+		fwrite(rom->p, rom->size, 1, gno);
 	} else {
 		Uint32 nb_block = rom->size / block_size;
 		Uint32 *block_offset;
@@ -1595,7 +1606,7 @@ static int dump_region(FILE *gno, const ROM_REGION *rom, Uint8 id, Uint8 type,
 
 int dr_save_gno(GAME_ROMS *r, char *filename) {
 	FILE *gno;
-	char *fid = "gnodmpv1";
+	char *fid = "gnodmpv2";
 	char fname[9];
 	Uint8 nb_sec = 0;
 	int i;
@@ -1661,16 +1672,16 @@ int dr_save_gno(GAME_ROMS *r, char *filename) {
 		dump_region(gno, &r->bios_sfix, REGION_FIXED_LAYER_BIOS, 0, 0, 0);
 	}
 	gn_update_pbar(3);
-	/* TODO, there is a bug in the loading routine, only one compressed (type 1)
-	 * region can be present at the end of the file */
-	dump_region(gno, &r->tiles, REGION_SPRITES, 1, 4096, 0);
+	/* Sprites are stored already converted and uncompressed, the loader maps
+	 * them in place and the OS pages them in as needed */
+	dump_region(gno, &r->tiles, REGION_SPRITES, 2, 0, 0);
 
 
 	fclose(gno);
 	return true;
 }
 
-int read_region(FILE *gno, GAME_ROMS *roms) {
+int read_region(void *contextPtr, const char *filename, FILE *gno, GAME_ROMS *roms) {
 	Uint32 size;
 	Uint8 lid, type;
 	ROM_REGION *r = NULL;
@@ -1725,6 +1736,19 @@ int read_region(FILE *gno, GAME_ROMS *roms) {
 		allocate_region(r, size, lid);
 		logMsg("Load %d %08x\n", lid, r->size);
 		totread += fread(r->p, r->size, 1, gno);
+	} else if (type == 2) {
+		Uint32 offset = GNO_PAGE_ALIGN(ftell(gno));
+		r->p = res_map_file_region(contextPtr, filename, offset, size);
+		if (r->p) {
+			logMsg("Mapped %d %08x at offset %08x\n", lid, size, offset);
+			r->size = size;
+			tiles_mapped = 1;
+		} else {
+			allocate_region(r, size, lid);
+			fseek(gno, offset, SEEK_SET);
+			totread += fread(r->p, r->size, 1, gno);
+		}
+		fseek(gno, offset + size, SEEK_SET);
 	} else {
 		Uint32 nb_block, block_size;
 		Uint32 cmp_size;
@@ -1756,7 +1780,7 @@ int read_region(FILE *gno, GAME_ROMS *roms) {
 
 int dr_open_gno(void *contextPtr, char *filename, char romerror[1024]) {
 	FILE *gno;
-	char fid[9]; // = "gnodmpv1";
+	char fid[9]; // = "gnodmpv1" or "gnodmpv2";
 	char name[9] = {0,};
 	GAME_ROMS *r = &memory.rom;
 	Uint8 nb_sec;
@@ -1778,7 +1802,7 @@ int dr_open_gno(void *contextPtr, char *filename, char romerror[1024]) {
 	}
 
 	totread += fread(fid, 8, 1, gno);
-	if (strncmp(fid, "gnodmpv1", 8) != 0) {
+	if (strncmp(fid, "gnodmpv1", 8) != 0 && strncmp(fid, "gnodmpv2", 8) != 0) {
 		fclose(gno);
 		sprintf(romerror, "Invalid GNO file");
 		return false;
@@ -1794,9 +1818,12 @@ int dr_open_gno(void *contextPtr, char *filename, char romerror[1024]) {
 	gn_init_pbar(PBAR_ACTION_LOADGNO, nb_sec);
 	for (i = 0; i < nb_sec; i++) {
 		gn_update_pbar(i);
-		read_region(gno, r);
+		read_region(contextPtr, filename, gno, r);
 	}
 	gn_terminate_pbar();
+	/* Only the compressed v1 sprite cache reads from the file after loading */
+	if (!memory.vid.spr_cache.data)
+		fclose(gno);
 
 	if (r->adpcmb.p == NULL) {
 		r->adpcmb.p = r->adpcma.p;
@@ -1836,7 +1863,7 @@ char *dr_gno_romname(char *filename) {
 		return NULL;
 
 	totread += fread(fid, 8, 1, gno);
-	if (strncmp(fid, "gnodmpv1", 8) != 0) {
+	if (strncmp(fid, "gnodmpv1", 8) != 0 && strncmp(fid, "gnodmpv2", 8) != 0) {
 		fclose(gno);
 		logMsg("Invalid GNO file");
 		return NULL;
@@ -1863,7 +1890,12 @@ void dr_free_roms(GAME_ROMS *r) {
 	free_region(&r->cpu_m68k);
 	free_region(&r->cpu_z80c);
 
-	if (!memory.vid.spr_cache.data) {
+	if (tiles_mapped) {
+		res_unmap_file_regions();
+		tiles_mapped = 0;
+		r->tiles.p = NULL;
+		r->tiles.size = 0;
+	} else if (!memory.vid.spr_cache.data) {
 		logMsg("Free tiles\n");
 		free_region(&r->tiles);
 	} else {
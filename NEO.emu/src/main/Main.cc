@@ -21,6 +21,10 @@
 #include <imagine/io/FileIO.hh>
 #include <imagine/util/ScopeGuard.hh>
 #include <imagine/util/format.hh>
+#include <imagine/time/Time.hh>
+#include <thread>
+#include <barrier>
+#include <atomic>
 
 extern "C"
 {
@@ -210,6 +214,19 @@ void NeoSystem::closeSystem()
 	memcardFileIO = {};
 }
 
+void NeoSystem::addMemoryUsage(MemoryUsageReport &report) const
+{
+	const auto &rom = memory.rom;
+	report.add("68K ROM", rom.cpu_m68k.size);
+	report.add("Z80 ROM", rom.cpu_z80.size + rom.cpu_z80c.size);
+	report.add("Sprite ROM", rom.tiles.size);
+	report.add("Sprite Usage", rom.spr_usage.size);
+	report.add("Fix ROM", rom.game_sfix.size + rom.bios_sfix.size + rom.gfix_usage.size);
+	report.add("ADPCM ROM", rom.adpcma.size + rom.adpcmb.size);
+	report.add("BIOS", rom.bios_m68k.size + rom.bios_audio.size);
+	report.add("Sprite Cache", memory.vid.spr_cache.size);
+}
+
 static auto openGngeoDataIO(IG::ApplicationContext ctx, IG::CStringView filename)
 {
 	#ifdef __ANDROID__
@@ -248,10 +265,13 @@ void NeoSystem::loadContent(IO &, EmuSystemCreateParams, OnLoadProgressDelegate
 	else
 	{
 		char errorStr[1024];
-		if(!init_game(&ctx, drv->name, errorStr))
+		bool loaded{};
+		auto loadTime = IG::timeFunc([&](){ loaded = init_game(&ctx, drv->name, errorStr); });
+		if(!loaded)
 		{
 			throw std::runtime_error(errorStr);
 		}
+		logMsg("loaded rom set in %.3fs", IG::FloatSeconds(loadTime).count());
 
 		if(optionCreateAndUseCache && !ctx.fileUriExists(gnoFilename))
 		{
@@ -300,11 +320,15 @@ void NeoSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio
 		std::ranges::fill(screenBuff, (uint16_t)current_pc_pal[4095]);
 	main_frame(&taskCtx, this, video);
 	auto audioFrames = updateAudioFramesPerVideoFrame();
-	Uint16 audioBuff[audioFrames * 2];
-	YM2610Update_stream(audioFrames, audioBuff);
 	if(audio)
 	{
-		audio->writeFrames(audioBuff, audioFrames);
+		YM2610Update_stream(audioFrames, (Uint16*)audio->frameWriteBuffer(audioFrames));
+		audio->commitFrames(audioFrames);
+	}
+	else
+	{
+		Uint16 audioBuff[audioFrames * 2];
+		YM2610Update_stream(audioFrames, audioBuff);
 	}
 }
 
@@ -387,6 +411,33 @@ CLINK void *res_load_data(void *contextPtr, const char *name)
 	return buffer;
 }
 
+static IG::MapIO mappedFileRegion;
+
+CLINK Uint8 *res_map_file_region(void *contextPtr, const char *filename, Uint32 offset, Uint32 size)
+{
+	try
+	{
+		IG::MapIO io{((IG::ApplicationContext*)contextPtr)->openFileUri(filename, IOAccessHint::Random)};
+		if(io.subSpan(offset, size).size() != size)
+		{
+			logErr("region %u:%u past end of %s", offset, size, filename);
+			return nullptr;
+		}
+		mappedFileRegion = std::move(io);
+		return mappedFileRegion.data() + offset;
+	}
+	catch(std::exception &err)
+	{
+		logErr("error mapping %s:%s", filename, err.what());
+		return nullptr;
+	}
+}
+
+CLINK void res_unmap_file_regions()
+{
+	mappedFileRegion = {};
+}
+
 CLINK void screen_update(void *emuTaskCtxPtr, void *neoSystemPtr, void *emuVideoPtr)
 {
 	auto taskCtxPtr = (EmuSystemTaskContext*)emuTaskCtxPtr;
@@ -441,3 +492,52 @@ void gn_update_pbar(int pos)
 		sys.onLoadProgress(pos, 0, nullptr);
 	}
 }
+
+void gn_parallel_for(const gn_parallel_func *funcs, unsigned passes, void *data, unsigned count)
+{
+	constexpr unsigned chunkSize = 0x10000;
+	const unsigned chunks = (count + chunkSize - 1) / chunkSize;
+	const unsigned threads = std::clamp(unsigned(gSystem().appContext().cpuCount()), 1u, std::max(chunks, 1u));
+	std::atomic_uint nextChunk{}, doneItems{};
+	// all threads finish a pass before any starts the next, counters reset in between
+	std::barrier passBarrier{std::ptrdiff_t(threads), [&]() noexcept
+	{
+		nextChunk.store(0, std::memory_order_relaxed);
+		doneItems.store(0, std::memory_order_relaxed);
+	}};
+	auto runPass = [&](gn_parallel_func func, auto &&onChunkDone)
+	{
+		for(unsigned c; (c = nextChunk.fetch_add(1, std::memory_order_relaxed)) < chunks;)
+		{
+			const unsigned start = c * chunkSize;
+			const unsigned end = std::min(count, start + chunkSize);
+			func(data, start, end);
+			doneItems.fetch_add(end - start, std::memory_order_relaxed);
+			onChunkDone();
+		}
+	};
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	for(unsigned i = 0; i < threads - 1; i++)
+	{
+		workers.emplace_back([&]()
+		{
+			for(unsigned pass = 0; pass < passes; pass++)
+			{
+				runPass(funcs[pass], []{});
+				passBarrier.arrive_and_wait();
+			}
+		});
+	}
+	// calling thread also runs chunks and reports the progress of all threads
+	for(unsigned pass = 0; pass < passes; pass++)
+	{
+		runPass(funcs[pass], [&]{ gn_update_pbar(pass * count + doneItems.load(std::memory_order_relaxed)); });
+		passBarrier.arrive_and_wait();
+		gn_update_pbar((pass + 1) * count);
+	}
+	for(auto &t : workers)
+	{
+		t.join();
+	}
+}
@@ -87,6 +87,7 @@ public:
 	void onFlushBackupMemory(EmuApp &, BackupMemoryDirtyFlags);
 	WallClockTimePoint backupMemoryLastWriteTime(const EmuApp &) const;
 	FS::FileString contentDisplayNameForPath(IG::CStringView path) const;
+	void addMemoryUsage(MemoryUsageReport &) const;
 };
 
 using MainSystem = NeoSystem;
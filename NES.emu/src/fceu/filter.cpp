@@ -8,13 +8,36 @@
 #include "fceu.h"
 #include "filter.h"
 
-#include "fcoeffs.h"
-
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
+
+/* FIR lengths for sound quality 2 & 1, multiples of 4 for the SIMD loop.
+   A Kaiser window needs more taps than the old equiripple tables for the same
+   stop band, so quality 1 uses 640 instead of 484 to keep their pass band. */
+#define SQ2NCOEFFS 1024
+#define NCOEFFS 640
+
+/* Stop band attenuation in dB each quality level must reach, a few dB above
+   what the old tables measured (~60 dB for 1, ~71 dB for 2). Wider transition
+   bands at high output rates get more, up to MAXATTEN. */
+#define NCOEFFS_ATTEN 66
+#define SQ2NCOEFFS_ATTEN 76
+#define MAXATTEN 120
+
+/* Number of fractional positions per input sample the kernel is designed for,
+   outputs between two positions are linearly interpolated */
+#define NPHASES 32
+
+typedef float float4 __attribute__((vector_size(16)));
+typedef int32 int4 __attribute__((vector_size(16)));
 
-static int32 sq2coeffs[SQ2NCOEFFS];
-static int32 coeffs[NCOEFFS];
+/* NPHASES+1 kernels, the last one is phase 0 delayed by a full sample so
+   every phase has a right neighbour to interpolate with */
+static float polycoeffs[(NPHASES+1)*SQ2NCOEFFS];
+static uint32 ncoeffs;
 
 static uint32 mrindex;
 static uint32 mrratio;
@@ -93,69 +116,52 @@ void SexyFilter(int32 *in, int32 *out, int32 count)
    code to be higher, or you *might* overflow the FIR code.
 */
 
+/* Evaluates the kernels of two adjacent phases in one pass over the input
+   and interpolates between their outputs by frac */
+static inline float FIRPhase(const int32 *in, const float *coeffs, uint32 nco, float frac)
+{
+ const float *coeffs2=coeffs+nco;
+ float4 acc={0,0,0,0},acc2={0,0,0,0};
+
+ for(uint32 c=0;c<nco;c+=4)
+ {
+  int4 s;
+  float4 d,d2;
+  memcpy(&s,in+c,sizeof(s));
+  memcpy(&d,coeffs+c,sizeof(d));
+  memcpy(&d2,coeffs2+c,sizeof(d2));
+  const float4 fs=__builtin_convertvector(s,float4);
+  acc+=fs*d;
+  acc2+=fs*d2;
+ }
+ const float out=(acc[0]+acc[1])+(acc[2]+acc[3]);
+ const float out2=(acc2[0]+acc2[1])+(acc2[2]+acc2[3]);
+ return out+(out2-out)*frac;
+}
+
 int32 NeoFilterSound(int32 *in, int32 *out, uint32 inlen, int32 *leftover)
 {
 	uint32 x;
 	uint32 max;
 	int32 *outsave=out;
 	int32 count=0;
+	const uint32 nco=ncoeffs;
 
-//	for(x=0;x<inlen;x++)
-//	{
-//	 if(in[x]>mva){ mva=in[x]; printf("%ld\n",in[x]);}
-//	}
         max=(inlen-1)<<16;
 
-	if(FSettings.soundq==2)
-        for(x=mrindex;x<max;x+=mrratio)
-        {
-			int32 acc=0,acc2=0;
-			unsigned int c;
-			int32 *S,*D;
-
-			for(c=SQ2NCOEFFS,S=&in[(x>>16)-SQ2NCOEFFS],D=sq2coeffs;c;c--,D++)
-			{
-				acc+=(S[c]**D)>>6;
-				acc2+=(S[1+c]**D)>>6;
-			}
-
-			acc=((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11);
-			*out=acc;
-			out++;
-			count++;
-        }
-	else
-		for(x=mrindex;x<max;x+=mrratio)
-		{
-			int32 acc=0,acc2=0;
-			unsigned int c;
-			const int32 *S,*D;
-
-			for(c=NCOEFFS,S=&in[(x>>16)-NCOEFFS],D=coeffs;c;c--,D++)
-			{
-				acc+=(S[c]**D)>>6;
-				acc2+=(S[1+c]**D)>>6;
-			}
-
-			acc=((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11);
-			*out=acc;
-			out++;
-			count++;
-		}
-
-	mrindex=x-max;
-
-	if(FSettings.soundq==2)
+	for(x=mrindex;x<max;x+=mrratio)
 	{
-         mrindex+=SQ2NCOEFFS*65536;
-         *leftover=SQ2NCOEFFS+1;
-	}
-	else
-	{
-         mrindex+=NCOEFFS*65536;
-         *leftover=NCOEFFS+1;
+		const uint32 phase=(x&65535)*NPHASES;
+		const float *D=&polycoeffs[(phase>>16)*nco];
+		*out=(int32)FIRPhase(&in[(x>>16)+2-nco],D,nco,(phase&65535)*(1.f/65536));
+		out++;
+		count++;
 	}
 
+	mrindex=x-max;
+	mrindex+=nco*65536;
+	*leftover=nco+1;
+
 	if(GameExpSound.NeoFill)
 	 GameExpSound.NeoFill(outsave,count);
 
@@ -165,45 +171,115 @@ int32 NeoFilterSound(int32 *in, int32 *out, uint32 inlen, int32 *leftover)
 	return(count);
 }
 
-void MakeFilters(int32 rate)
+static double BesselI0(double x)
 {
- const int32 *tabs[6]={C44100NTSC,C44100PAL,C48000NTSC,C48000PAL,C96000NTSC,
-        C96000PAL};
- const int32 *sq2tabs[6]={SQ2C44100NTSC,SQ2C44100PAL,SQ2C48000NTSC,SQ2C48000PAL,
-	SQ2C96000NTSC,SQ2C96000PAL};
+ double sum=1,term=1;
+
+ /* terms peak around k=x/2, so the series runs until they fall below double
+    precision instead of for a fixed count */
+ for(int k=1;k<1000;k++)
+ {
+  term*=(x/(2*k))*(x/(2*k));
+  sum+=term;
+  if(k>x/2 && term<sum*1e-17) break;
+ }
+ return sum;
+}
 
- const int32 *tmp;
- int32 x;
- uint32 nco;
+#ifndef NDEBUG
+/* Returns the smallest attenuation in dB, relative to DC, of kernel D between
+   the normalized frequency stop and the input Nyquist frequency */
+static double StopBandAttenuation(const float *D, uint32 nco, double stop)
+{
+ double dc=0;
+ for(uint32 c=0;c<nco;c++)
+  dc+=D[c];
+
+ double worst=0;
+ /* 8 points per side lobe */
+ for(double f=stop;f<0.5;f+=1.0/(8*nco))
+ {
+  /* rotate by e^(-j2pi*f) per tap instead of calling sin/cos for each one */
+  const double wr=cos(2*M_PI*f),wi=-sin(2*M_PI*f);
+  double er=1,ei=0,re=0,im=0;
+  for(uint32 c=0;c<nco;c++)
+  {
+   re+=D[c]*er;
+   im+=D[c]*ei;
+   const double t=er*wr-ei*wi;
+   ei=er*wi+ei*wr;
+   er=t;
+  }
+  worst=std::max(worst,sqrt(re*re+im*im));
+ }
+ return -20*log10(worst/fabs(dc));
+}
+#endif
 
- if(FSettings.soundq==2)
-  nco=SQ2NCOEFFS;
- else
-  nco=NCOEFFS;
+/* Designs a Kaiser windowed-sinc low pass for the current output rate, split
+   into NPHASES polyphase kernels. The stop band starts at the output Nyquist
+   frequency like in the old fixed Parks-McClellan tables, and the pass band
+   edge is placed so the stop band reaches the quality level's attenuation. */
+void MakeFilters(int32 rate)
+{
+ const double cpuRate=PAL?PAL_CPU:NTSC_CPU;
+ const uint32 nco=FSettings.soundq==2?SQ2NCOEFFS:NCOEFFS;
 
+ ncoeffs=nco;
  mrindex=(nco+1)<<16;
- mrratio=(PAL?(int64)(PAL_CPU*65536):(int64)(NTSC_CPU*65536))/rate;
+ mrratio=(int64)(cpuRate*65536)/rate;
+
+ /* Kaiser's estimate: atten = 14.36*(stopEdge-passEdge)/cpuRate*(nco-1)+7.95.
+    Start from a pass band of 0.30 (quality 1) or 0.33 (quality 2) of the
+    output rate and widen the transition band if that falls short. */
+ const double minAtten=FSettings.soundq==2?SQ2NCOEFFS_ATTEN:NCOEFFS_ATTEN;
+ const double passFrac=FSettings.soundq==2?0.33:0.30;
+ const double attenPerHz=14.36*(nco-1)/cpuRate;
+ const double stopEdge=0.5*rate;
+ const double atten=std::clamp(attenPerHz*(stopEdge-passFrac*rate)+7.95,minAtten,(double)MAXATTEN);
+ const double passEdge=stopEdge-(atten-7.95)/attenPerHz;
+ const double cutoff=(passEdge+stopEdge)/2/cpuRate;
+ double beta=0;
+ if(atten>50)
+  beta=0.1102*(atten-8.7);
+ else if(atten>21)
+  beta=0.5842*pow(atten-21,0.4)+0.07886*(atten-21);
+ const double betaI0=BesselI0(beta);
+ const double halfLen=nco/2.0;
+
+ for(uint32 p=0;p<=NPHASES;p++)
+ {
+  float *D=&polycoeffs[p*nco];
+  /* tap c reads in[i+2-nco+c] for an output at position i + p/NPHASES */
+  const double offset=1-halfLen-(double)p/NPHASES;
+  double sum=0;
+  double taps[SQ2NCOEFFS];
 
- if(FSettings.soundq==2)
-  tmp=sq2tabs[(PAL?1:0)|(rate==48000?2:0)|(rate==96000?4:0)];
- else
-  tmp=tabs[(PAL?1:0)|(rate==48000?2:0)|(rate==96000?4:0)];
+  for(uint32 c=0;c<nco;c++)
+  {
+   const double t=c+offset;
+   const double w=t/halfLen;
+   const double win=w*w<1?BesselI0(beta*sqrt(1-w*w))/betaI0:0;
+   const double sinc=t==0?2*cutoff:sin(2*M_PI*cutoff*t)/(M_PI*t);
+   taps[c]=sinc*win;
+   sum+=taps[c];
+  }
+  /* DC gain of 8, same as the old integer tables (coefficients summing to
+     2^20, scaled down by 2^17 in the old FIR loop) */
+  for(uint32 c=0;c<nco;c++)
+   D[c]=taps[c]*8/sum;
+ }
 
- if(FSettings.soundq==2)
-  for(x=0;x<SQ2NCOEFFS>>1;x++)
-   sq2coeffs[x]=sq2coeffs[SQ2NCOEFFS-1-x]=tmp[x];
- else
-  for(x=0;x<NCOEFFS>>1;x++)
-   coeffs[x]=coeffs[NCOEFFS-1-x]=tmp[x];
+ /* Kaiser's estimate is good to about 2 dB */
+ assert(StopBandAttenuation(polycoeffs,nco,stopEdge/cpuRate)>=atten-3);
 
  #ifdef MOO
  /* Some tests involving precision and error. */
  {
-  static int64 acc=0;
-  int x;
-  for(x=0;x<SQ2NCOEFFS;x++)
-   acc+=(int64)32767*sq2coeffs[x];
-  printf("Foo: %lld\n",acc);
+  double acc=0;
+  for(uint32 x=0;x<nco;x++)
+   acc+=32767*polycoeffs[x];
+  printf("Foo: %f\n",acc);
  }
  #endif
 }
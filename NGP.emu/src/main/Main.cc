@@ -73,6 +73,16 @@ void NgpSystem::saveState(IG::CStringView path)
 		throwFileWriteError();
 }
 
+ByteBuffer NgpSystem::saveStateToBuffer()
+{
+	return saveStateToBufferMDFN();
+}
+
+ByteBuffer NgpSystem::stateFileData(ByteBuffer buff) const
+{
+	return stateFileDataMDFN(std::move(buff));
+}
+
 void NgpSystem::loadState(EmuApp &, IG::CStringView path)
 {
 	if(!MDFNI_LoadState(path, 0))
@@ -132,9 +142,14 @@ void NgpSystem::configAudioRate(FrameTime outputFrameTime, int outputRate)
 }
 
 void NgpSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio)
+{
+	runFrames(taskCtx, video, audio, 1);
+}
+
+void NgpSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
 {
 	static constexpr size_t maxAudioFrames = 48000 / minFrameRate;
-	EmuEx::runFrame(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames);
+	EmuEx::runFrames(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames, frames);
 }
 
 void EmuApp::onCustomizeNavView(EmuApp::NavView &view)
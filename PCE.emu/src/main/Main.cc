@@ -218,10 +218,15 @@ void PceSystem::configAudioRate(FrameTime outputFrameTime, int outputRate)
 }
 
 void PceSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio)
+{
+	runFrames(taskCtx, video, audio, 1);
+}
+
+void PceSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
 {
 	static constexpr size_t maxAudioFrames = 48000 / minFrameRate;
 	static constexpr size_t maxLineWidths = 264;
-	EmuEx::runFrame(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames, maxLineWidths);
+	EmuEx::runFrames(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames, frames, maxLineWidths);
 	if(configuredFor263Lines != isUsing263Lines()) [[unlikely]]
 	{
 		onFrameTimeChanged();
@@ -240,6 +245,16 @@ void PceSystem::saveState(IG::CStringView path)
 		throwFileWriteError();
 }
 
+ByteBuffer PceSystem::saveStateToBuffer()
+{
+	return saveStateToBufferMDFN();
+}
+
+ByteBuffer PceSystem::stateFileData(ByteBuffer buff) const
+{
+	return stateFileDataMDFN(std::move(buff));
+}
+
 void PceSystem::loadState(EmuApp &, CStringView path)
 {
 	if(!MDFNI_LoadState(path, 0))
@@ -276,7 +291,8 @@ void MDFN_MidSync(EmulateSpecStruct *espec, const unsigned flags)
 {
 	if(!espec->audio)
 		return;
-	espec->audio->writeFrames(espec->SoundBuf, std::exchange(espec->SoundBufSize, 0));
+	espec->audio->commitFrames(std::exchange(espec->SoundBufSize, 0));
+	espec->SoundBuf = (int16*)espec->audio->frameWriteBuffer(espec->SoundBufMaxSize);
 }
 
 template <class Pixel>
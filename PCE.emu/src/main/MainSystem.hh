@@ -140,10 +140,13 @@ public:
 	// required API functions
 	void loadContent(IO &, EmuSystemCreateParams, OnLoadProgressDelegate);
 	[[gnu::hot]] void runFrame(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *audio);
+	[[gnu::hot]] void runFrames(EmuSystemTaskContext task, EmuVideo *video, EmuAudio *audio, int frames);
 	FS::FileString stateFilename(int slot, std::string_view name) const;
 	std::string_view stateFilenameExt() const { return ".mca"; }
 	void loadState(EmuApp &, CStringView uri);
 	void saveState(CStringView path);
+	ByteBuffer saveStateToBuffer();
+	ByteBuffer stateFileData(ByteBuffer) const;
 	bool readConfig(ConfigType, MapIO &, unsigned key, size_t readSize);
 	void writeConfig(ConfigType, FileIO &);
 	void reset(EmuApp &, ResetMode mode);
@@ -310,12 +310,20 @@ void SaturnSystem::configAudioRate(FrameTime outputFrameTime, int outputRate)
 }
 
 void SaturnSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio)
+{
+	runFrames(taskCtx, video, audio, 1);
+}
+
+void SaturnSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
 {
 	emuSysTask = taskCtx;
-	emuVideo = video;
 	emuAudio = audio;
 	SNDImagine.UpdateAudio = audio ? SNDImagineUpdateAudio : SNDImagineUpdateAudioNull;
-	YabauseEmulate();
+	for(auto i : iotaCount(frames))
+	{
+		emuVideo = i == frames - 1 ? video : nullptr;
+		YabauseEmulate();
+	}
 	emuAudio = {};
 }
 
@@ -336,15 +344,14 @@ void EmuApp::onCustomizeNavView(EmuApp::NavView &view)
 static void SNDImagineUpdateAudio(u32 *leftchanbuffer, u32 *rightchanbuffer, u32 frames)
 {
 	//logMsg("got %d audio frames to write", frames);
-	s16 sample[frames*2];
+	if(!EmuEx::emuAudio)
+		return;
+	auto sample = (s16*)EmuEx::emuAudio->frameWriteBuffer(frames);
 	for(auto i : IG::iotaCount(frames))
 	{
 		mergeSamplesToStereo(leftchanbuffer[i], rightchanbuffer[i], &sample[i*2]);
 	}
-	if(EmuEx::emuAudio)
-	{
-		EmuEx::emuAudio->writeFrames(sample, frames);
-	}
+	EmuEx::emuAudio->commitFrames(frames);
 }
 
 CLINK void DisplayMessage(const char* str) {}
@@ -1,5 +1,6 @@
 #include <emuframework/EmuApp.hh>
 #include <emuframework/AudioOptionView.hh>
+#include <emuframework/VideoOptionView.hh>
 #include <emuframework/FilePathOptionView.hh>
 #include <emuframework/DataPathSelectView.hh>
 #include <emuframework/UserPathSelectView.hh>
@@ -56,6 +57,30 @@ public:
 		item.emplace_back(&dspInterpolation);
 	}
 };
+
+class CustomVideoOptionView : public VideoOptionView, public MainAppHelper<CustomVideoOptionView>
+{
+	using MainAppHelper<CustomVideoOptionView>::system;
+
+	BoolMenuItem renderThread
+	{
+		"Render Video On Separate Thread", &defaultFace(),
+		(bool)system().optionRenderThread,
+		[this](BoolMenuItem &item)
+		{
+			system().optionRenderThread = item.flipBoolValue(*this);
+			S9xSetRenderThread(system().optionRenderThread);
+		}
+	};
+
+public:
+	CustomVideoOptionView(ViewAttachParams attach): VideoOptionView{attach, true}
+	{
+		loadStockItems();
+		item.emplace_back(&systemSpecificHeading);
+		item.emplace_back(&renderThread);
+	}
+};
 #endif
 
 class ConsoleOptionView : public TableView, public MainAppHelper<ConsoleOptionView>
@@ -384,6 +409,7 @@ std::unique_ptr<View> EmuApp::makeCustomView(ViewAttachParams attach, ViewID id)
 	{
 		#ifndef SNES9X_VERSION_1_4
 		case ViewID::AUDIO_OPTIONS: return std::make_unique<CustomAudioOptionView>(attach);
+		case ViewID::VIDEO_OPTIONS: return std::make_unique<CustomVideoOptionView>(attach);
 		#endif
 		case ViewID::FILE_PATH_OPTIONS: return std::make_unique<CustomFilePathOptionView>(attach);
 		case ViewID::SYSTEM_ACTIONS: return std::make_unique<CustomSystemActionsView>(attach);
@@ -145,6 +145,18 @@ WallClockTimePoint Snes9xSystem::backupMemoryLastWriteTime(const EmuApp &app) co
 VideoSystem Snes9xSystem::videoSystem() const { return Settings.PAL ? VideoSystem::PAL : VideoSystem::NATIVE_NTSC; }
 WSize Snes9xSystem::multiresVideoBaseSize() const { return {256, 239}; }
 
+#ifndef SNES9X_VERSION_1_4
+void Snes9xSystem::addMemoryUsage(MemoryUsageReport &report) const
+{
+	report.add("ROM", Memory.ROMStorage.capacity());
+	report.add("RAM/VRAM", sizeof(Memory.RAM) + sizeof(Memory.VRAM));
+	// each cached tile's pixels plus its entry in the matching TileCached flag array
+	report.add("Tile Cache", (MAX_2BIT_TILES * 3 + MAX_4BIT_TILES * 3 + MAX_8BIT_TILES) *
+		(TILE_CACHE_TILE_SIZE + sizeof(*IPPU.TileCached[0])));
+	report.add("Screen Buffers", GFX.ScreenBuffer.capacity() * sizeof(uint16) + GFX.ScreenSize * 4);
+}
+#endif
+
 static bool isSufamiTurboCart(const IOBuffer &buff)
 {
 	return buff.size() >= 0x80000 && buff.size() <= 0x100000 &&
@@ -267,12 +279,16 @@ static void mixSamples(int samples, EmuAudio *audio)
 	if(!samples) [[unlikely]]
 		return;
 	assumeExpr(samples % 2 == 0);
-	int16_t audioBuff[1800];
-	S9xMixSamples((uint8*)audioBuff, samples);
 	if(audio)
 	{
 		//logMsg("%d frames", samples / 2);
-		audio->writeFrames(audioBuff, samples / 2);
+		S9xMixSamples((uint8*)audio->frameWriteBuffer(samples / 2), samples);
+		audio->commitFrames(samples / 2);
+	}
+	else
+	{
+		int16_t audioBuff[1800];
+		S9xMixSamples((uint8*)audioBuff, samples);
 	}
 }
 
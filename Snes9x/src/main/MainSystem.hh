@@ -31,7 +31,7 @@ enum
 	CFGKEY_SUPERFX_CLOCK_MULTIPLIER = 282, CFGKEY_ALLOW_EXTENDED_VIDEO_LINES = 283,
 	CFGKEY_CHEATS_PATH = 284, CFGKEY_PATCHES_PATH = 285,
 	CFGKEY_SATELLAVIEW_PATH = 286, CFGKEY_SUFAMI_BIOS_PATH = 287,
-	CFGKEY_BSX_BIOS_PATH = 288,
+	CFGKEY_BSX_BIOS_PATH = 288, CFGKEY_RENDER_THREAD = 289,
 };
 
 #ifdef SNES9X_VERSION_1_4
@@ -83,6 +83,7 @@ public:
 	Byte1Option optionSeparateEchoBuffer{CFGKEY_SEPARATE_ECHO_BUFFER, 0};
 	Byte1Option optionSuperFXClockMultiplier{CFGKEY_SUPERFX_CLOCK_MULTIPLIER, 100, false, optionIsValidWithMinMax<5, 250>};
 	Byte1Option optionAudioDSPInterpolation{CFGKEY_AUDIO_DSP_INTERPOLATON, DSP_INTERPOLATION_GAUSSIAN, false, optionIsValidWithMax<4>};
+	Byte1Option optionRenderThread{CFGKEY_RENDER_THREAD, 0};
 	#endif
 	static constexpr FloatSeconds ntscFrameTimeSecs{357366. / 21477272.}; // ~60.098Hz
 	static constexpr FloatSeconds palFrameTimeSecs{425568. / 21281370.}; // ~50.00Hz
@@ -145,6 +146,9 @@ public:
 	bool onPointerInputUpdate(const Input::MotionEvent &, Input::DragTrackerState,
 		Input::DragTrackerState prevDragState, IG::WindowRect gameRect);
 	bool onPointerInputEnd(const Input::MotionEvent &, Input::DragTrackerState, IG::WindowRect gameRect);
+	#ifndef SNES9X_VERSION_1_4
+	void addMemoryUsage(MemoryUsageReport &) const;
+	#endif
 
 protected:
 	void applyInputPortOption(int portVal, VController &vCtrl);
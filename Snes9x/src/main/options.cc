@@ -48,6 +48,7 @@ void Snes9xSystem::onOptionsLoaded()
 {
 	#ifndef SNES9X_VERSION_1_4
 	SNES::dsp.spc_dsp.interpolation = optionAudioDSPInterpolation;
+	S9xSetRenderThread(optionRenderThread);
 	#endif
 }
 
@@ -59,6 +60,7 @@ bool Snes9xSystem::readConfig(ConfigType type, MapIO &io, unsigned key, size_t r
 		{
 			#ifndef SNES9X_VERSION_1_4
 			case CFGKEY_AUDIO_DSP_INTERPOLATON: return optionAudioDSPInterpolation.readFromIO(io, readSize);
+			case CFGKEY_RENDER_THREAD: return optionRenderThread.readFromIO(io, readSize);
 			#endif
 			case CFGKEY_CHEATS_PATH: return readStringOptionValue(io, readSize, cheatsDir);
 			case CFGKEY_PATCHES_PATH: return readStringOptionValue(io, readSize, patchesDir);
@@ -91,6 +93,7 @@ void Snes9xSystem::writeConfig(ConfigType type, FileIO &io)
 	{
 		#ifndef SNES9X_VERSION_1_4
 		optionAudioDSPInterpolation.writeWithKeyIfNotDefault(io);
+		optionRenderThread.writeWithKeyIfNotDefault(io);
 		#endif
 		writeStringOptionValue(io, CFGKEY_CHEATS_PATH, cheatsDir);
 		writeStringOptionValue(io, CFGKEY_PATCHES_PATH, patchesDir);
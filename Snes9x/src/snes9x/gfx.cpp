@@ -14,6 +14,9 @@
 #include "screenshot.h"
 #include "font.h"
 #include "display.h"
+#include <imagine/logger/logger.h>
+#include <semaphore>
+#include <thread>
 
 extern struct SCheatData		Cheat;
 
@@ -23,6 +26,8 @@ static int	font_width = 8, font_height = 9;
 void (*S9xCustomDisplayString) (const char *, int, int, bool, int) = NULL;
 
 static void SetupOBJ (void);
+static void RenderLines (void);
+static void UpdateScreen (bool8);
 static void DrawOBJS (int);
 static void DisplayTime (void);
 static void DisplayFrameRate (void);
@@ -41,6 +46,49 @@ static void S9xDisplayStringType (const char *, int, int, bool, int);
 
 #define TILE_PLUS(t, x)	(((t) & 0xfc00) | ((t + x) & 0x3ff))
 
+// Renders the lines between GFX.StartY & GFX.EndY while the CPU emulates the
+// following ones, with at most one batch of lines in flight
+static struct RenderThread
+{
+	std::thread thread;
+	std::binary_semaphore linesSem{0}, linesDoneSem{0};
+	bool quit;
+
+	~RenderThread() { stop(); }
+
+	bool8 isRunning() const { return thread.joinable(); }
+
+	void start()
+	{
+		if (thread.joinable())
+			return;
+		quit = false;
+		thread = std::thread{[this]()
+		{
+			logMsg("starting PPU render thread");
+			for (;;)
+			{
+				linesSem.acquire();
+				if (quit)
+					return;
+				RenderLines();
+				linesDoneSem.release();
+			}
+		}};
+	}
+
+	void stop()
+	{
+		if (!thread.joinable())
+			return;
+		S9xSyncRender();
+		quit = true;
+		linesSem.release();
+		thread.join();
+		logMsg("stopped PPU render thread");
+	}
+} renderThread;
+
 
 bool8 S9xGraphicsInit (void)
 {
@@ -151,6 +199,8 @@ void S9xBuildDirectColourMaps (void)
 
 void S9xStartScreenRefresh (void)
 {
+	S9xSyncRender();
+
 	if (GFX.DoInterlace)
 		GFX.DoInterlace--;
 
@@ -269,6 +319,19 @@ void RenderLine (uint8 C)
 		}
 
 		IPPU.CurrentLine = C + 1;
+
+		if (renderThread.isRunning())
+		{
+			// queue this line with any others rendered since the last batch,
+			// unless the previous batch is still in progress
+			if (IPPU.RenderPending)
+			{
+				if (!renderThread.linesDoneSem.try_acquire())
+					return;
+				IPPU.RenderPending = FALSE;
+			}
+			UpdateScreen(TRUE);
+		}
 	}
 	else
 	{
@@ -410,6 +473,27 @@ static inline void RenderScreen (bool8 sub)
 
 void S9xUpdateScreen (void)
 {
+	UpdateScreen(FALSE);
+}
+
+void S9xWaitRender (void)
+{
+	renderThread.linesDoneSem.acquire();
+	IPPU.RenderPending = FALSE;
+}
+
+void S9xSetRenderThread (bool8 on)
+{
+	if (on)
+		renderThread.start();
+	else
+		renderThread.stop();
+}
+
+static void UpdateScreen (bool8 async)
+{
+	// State shared with the CPU side is updated here so the render thread
+	// only writes to the frame buffers, tile caches and GFX
 	if (IPPU.OBJChanged || IPPU.InterlaceOBJ)
 		SetupOBJ();
 
@@ -420,17 +504,30 @@ void S9xUpdateScreen (void)
 	if ((GFX.EndY = IPPU.CurrentLine - 1) >= PPU.ScreenHeight)
 		GFX.EndY = PPU.ScreenHeight - 1;
 
+	if (!PPU.ForcedBlanking && PPU.RecomputeClipWindows)
+	{
+		S9xComputeClipWindows();
+		PPU.RecomputeClipWindows = FALSE;
+	}
+
+	IPPU.PreviousLine = IPPU.CurrentLine;
+
+	if (async)
+	{
+		IPPU.RenderPending = TRUE;
+		renderThread.linesSem.release();
+	}
+	else
+		RenderLines();
+}
+
+static void RenderLines (void)
+{
 	if (!PPU.ForcedBlanking)
 	{
 		// If force blank, may as well completely skip all this. We only did
 		// the OBJ because (AFAWK) the RTO flags are updated even during force-blank.
 
-		if (PPU.RecomputeClipWindows)
-		{
-			S9xComputeClipWindows();
-			PPU.RecomputeClipWindows = FALSE;
-		}
-
 		if (!IPPU.DoubleWidthPixels && (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.PseudoHires))
 		{
 			// Have to back out of the regular speed hack
@@ -481,8 +578,6 @@ void S9xUpdateScreen (void)
 			for (int x = 0; x < IPPU.RenderedScreenWidth; x++)
 				GFX.S[x] = black;
 	}
-
-	IPPU.PreviousLine = IPPU.CurrentLine;
 }
 
 static void SetupOBJ (void)
@@ -215,6 +215,7 @@ void S9xDisplayMessages (uint16 *, int, int, int, int);
 // external port interface which must be implemented or initialised for each port
 bool8 S9xGraphicsInit (void);
 void S9xGraphicsDeinit (void);
+void S9xSetRenderThread (bool8);
 bool8 S9xInitUpdate (void);
 bool8 S9xDeinitUpdate (int, int);
 bool8 S9xContinueUpdate (int, int);
@@ -1737,6 +1737,7 @@ void S9xResetPPU (void)
 
 void S9xResetPPUFast (void)
 {
+	S9xSyncRender();
 	PPU.RecomputeClipWindows = TRUE;
 	IPPU.ColorsChanged = TRUE;
 	IPPU.OBJChanged = TRUE;
@@ -1751,6 +1752,7 @@ void S9xResetPPUFast (void)
 
 void S9xSoftResetPPU (void)
 {
+	S9xSyncRender();
 	S9xControlsSoftReset();
 
 	PPU.VMA.High = 0;
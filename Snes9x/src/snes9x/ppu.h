@@ -20,6 +20,7 @@
 #define MAX_2BIT_TILES		4096
 #define MAX_4BIT_TILES		2048
 #define MAX_8BIT_TILES		1024
+#define TILE_CACHE_TILE_SIZE	64	// bytes per decoded 8x8 tile in IPPU.TileCache
 
 #define CLIP_OR				0
 #define CLIP_AND			1
@@ -63,6 +64,7 @@ struct InternalPPU
 	uint32	TotalEmulatedFrames;
 	uint32	SkippedFrames;
 	uint32	FrameSkip;
+	bool8	RenderPending;
 };
 
 struct SOBJ
@@ -235,8 +237,19 @@ extern const SnesModel	M2SNES;
 #define MAX_5A22_VERSION	0x02
 
 void S9xUpdateScreen (void);
+void S9xWaitRender (void);
+
+// Lines queued on the render thread read the current PPU state and VRAM,
+// anything that modifies them must wait for the render to finish first
+static inline void S9xSyncRender (void)
+{
+	if (IPPU.RenderPending)
+		S9xWaitRender();
+}
+
 static inline void FLUSH_REDRAW (void)
 {
+	S9xSyncRender();
 	if (IPPU.PreviousLine != IPPU.CurrentLine)
 		S9xUpdateScreen();
 }
@@ -369,6 +382,8 @@ static inline void REGISTER_2118 (uint8 Byte)
 	if(CHECK_INBLANK1(PPU, CPU))
 		return;
 
+	S9xSyncRender();
+
 	uint32	address;
 
 	if (PPU.VMA.FullGraphicCount)
@@ -407,6 +422,8 @@ static inline void REGISTER_2118_tile (uint8 Byte)
 	if(CHECK_INBLANK1(PPU, CPU))
 		return;
 
+	S9xSyncRender();
+
 	uint32 rem = PPU.VMA.Address & PPU.VMA.Mask1;
 	uint32 address = (((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) & 0xffff;
 
@@ -433,6 +450,8 @@ static inline void REGISTER_2118_linear (uint8 Byte)
 	if(CHECK_INBLANK1(PPU, CPU))
 		return;
 
+	S9xSyncRender();
+
 	uint32	address;
 
 	Memory.VRAM[address = (PPU.VMA.Address << 1) & 0xffff] = Byte;
@@ -484,6 +503,8 @@ static inline void REGISTER_2119 (uint8 Byte)
 {
 	if(CHECK_INBLANK2(PPU, CPU))
 		return;
+
+	S9xSyncRender();
 	uint32	address;
 
 	if (PPU.VMA.FullGraphicCount)
@@ -522,6 +543,8 @@ static inline void REGISTER_2119_tile (uint8 Byte)
 	if(CHECK_INBLANK2(PPU, CPU))
 		return;
 
+	S9xSyncRender();
+
 	uint32 rem = PPU.VMA.Address & PPU.VMA.Mask1;
 	uint32 address = ((((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) + 1) & 0xffff;
 
@@ -548,6 +571,8 @@ static inline void REGISTER_2119_linear (uint8 Byte)
 	if(CHECK_INBLANK2(PPU, CPU))
 		return;
 
+	S9xSyncRender();
+
 	uint32	address;
 
 	Memory.VRAM[address = ((PPU.VMA.Address << 1) + 1) & 0xffff] = Byte;
@@ -70,6 +70,16 @@ void WsSystem::saveState(IG::CStringView path)
 		throwFileWriteError();
 }
 
+ByteBuffer WsSystem::saveStateToBuffer()
+{
+	return saveStateToBufferMDFN();
+}
+
+ByteBuffer WsSystem::stateFileData(ByteBuffer buff) const
+{
+	return stateFileDataMDFN(std::move(buff));
+}
+
 void WsSystem::loadState(EmuApp &, IG::CStringView path)
 {
 	if(!MDFNI_LoadState(path, 0))
@@ -144,9 +154,14 @@ void WsSystem::configAudioRate(FrameTime outputFrameTime, int outputRate)
 }
 
 void WsSystem::runFrame(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio)
+{
+	runFrames(taskCtx, video, audio, 1);
+}
+
+void WsSystem::runFrames(EmuSystemTaskContext taskCtx, EmuVideo *video, EmuAudio *audio, int frames)
 {
 	static constexpr size_t maxAudioFrames = 48000 / minFrameRate;
-	EmuEx::runFrame(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames);
+	EmuEx::runFrames(*this, mdfnGameInfo, taskCtx, video, mSurfacePix, audio, maxAudioFrames, frames);
 	if(configuredLCDVTotal != lcdVTotal()) [[unlikely]]
 	{
 		onFrameTimeChanged();
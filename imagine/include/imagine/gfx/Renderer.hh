@@ -101,6 +101,7 @@ public:
 	void setCorrectnessChecks(bool on);
 	std::vector<DrawableConfigDesc> supportedDrawableConfigs() const;
 	bool hasBgraFormat(TextureBufferMode) const;
+	bool supportsBlendMinMax() const;
 
 	// shaders
 
@@ -58,7 +58,7 @@ enum class BlendMode: uint8_t { OFF, ALPHA, PREMULT_ALPHA, INTENSITY };
 
 enum class EnvMode: uint8_t { MODULATE, BLEND, REPLACE, ADD };
 
-enum class BlendEquation: uint8_t { ADD, SUB, RSUB };
+enum class BlendEquation: uint8_t { ADD, SUB, RSUB, MAX };
 
 enum class Faces: uint8_t { BOTH, FRONT, BACK };
 
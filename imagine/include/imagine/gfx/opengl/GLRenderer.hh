@@ -22,6 +22,7 @@
 #include <imagine/gfx/TextureSizeSupport.hh>
 #include <imagine/gfx/RendererTask.hh>
 #include <imagine/gfx/BasicEffect.hh>
+#include <imagine/fs/FSDefs.hh>
 #include <imagine/util/used.hh>
 #include <memory>
 #include <optional>
@@ -61,6 +62,8 @@ public:
 	void (* GL_APIENTRY glBufferStorage) (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags){};
 	void (* GL_APIENTRY glFlushMappedBufferRange)(GLenum target, GLintptr offset, GLsizeiptr length){};
 	//void (* GL_APIENTRY glMemoryBarrier) (GLbitfield barriers){};
+	void (* GL_APIENTRY glGetProgramBinary) (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary){};
+	void (* GL_APIENTRY glProgramBinary) (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length){};
 		#ifdef CONFIG_BASE_GL_PLATFORM_EGL
 		// Prototypes based on EGL_KHR_fence_sync/EGL_KHR_wait_sync versions
 		EGLSync (EGLAPIENTRY *eglCreateSync)(EGLDisplay dpy, EGLenum type, const EGLint *attrib_list){};
@@ -86,6 +89,8 @@ public:
 	static void glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) { ::glBufferStorage(target, size, data, flags); }
 	static void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { ::glFlushMappedBufferRange(target, offset, length); }
 	//static void glMemoryBarrier(GLbitfield barriers) { ::glMemoryBarrier(barriers); }
+	static void glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { ::glGetProgramBinary(program, bufSize, length, binaryFormat, binary); }
+	static void glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { ::glProgramBinary(program, binaryFormat, binary, length); }
 		#ifdef CONFIG_BASE_GL_PLATFORM_EGL
 		static EGLSync eglCreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib *attrib_list) { return ::eglCreateSync(dpy, type, attrib_list); }
 		static EGLBoolean eglDestroySync(EGLDisplay dpy, EGLSync sync) { return ::eglDestroySync(dpy, sync); }
@@ -136,6 +141,8 @@ public:
 	IG_UseMemberIf(Config::Gfx::OPENGL_TEXTURE_TARGET_EXTERNAL, bool, hasExternalEGLImages){};
 	IG_UseMemberIf(Config::Gfx::OPENGL_FIXED_FUNCTION_PIPELINE, bool, useFixedFunctionPipeline){true};
 	bool hasSrgbWriteControl{};
+	bool hasBlendMinMax = !Config::Gfx::OPENGL_ES;
+	bool hasProgramBinary{};
 	bool isConfigured{};
 
 	bool hasDrawReadBuffers() const;
@@ -159,6 +166,7 @@ public:
 	RendererTask mainTask;
 	BasicEffect basicEffect_{};
 	CustomEvent releaseShaderCompilerEvent{CustomEvent::NullInit{}};
+	FS::PathString programBinaryCachePath;
 
 	GLRenderer(ApplicationContext);
 	GLDisplay glDisplay() const;
@@ -183,6 +191,7 @@ protected:
 	void setupUnmapBufferFunc();
 	void setupImmutableBufferStorage();
 	void setupMemoryBarrier();
+	void setupProgramBinary(bool extSuffix);
 	void setupFenceSync();
 	void setupAppleFenceSync();
 	void setupEglFenceSync(std::string_view eglExtenstionStr);
@@ -68,6 +68,12 @@ typedef void (GL_APIENTRY *GLDEBUGPROCKHR)(GLenum source,GLenum type,GLuint id,G
 	#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
 	#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
 	#endif
+	#ifndef GL_PROGRAM_BINARY_LENGTH
+	#define GL_PROGRAM_BINARY_LENGTH 0x8741
+	#endif
+	#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+	#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+	#endif
 #endif
 
 #if CONFIG_GFX_OPENGL_ES == 1
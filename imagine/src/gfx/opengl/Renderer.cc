@@ -288,6 +288,8 @@ bool Renderer::supportsSyncFences() const
 
 bool Renderer::supportsPresentationTime() const { return glManager.hasPresentationTime(); }
 
+bool Renderer::supportsBlendMinMax() const { return support.hasBlendMinMax; }
+
 int GLRenderer::toSwapInterval(const Window &win, PresentMode mode) const
 {
 	switch(mode)
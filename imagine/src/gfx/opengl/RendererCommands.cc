@@ -28,6 +28,10 @@
 #include "internalDefs.hh"
 #include "utils.hh"
 
+#ifndef GL_MAX
+#define GL_MAX 0x8008
+#endif
+
 namespace IG::Gfx
 {
 
@@ -243,6 +247,7 @@ void RendererCommands::setBlendEquation(BlendEquation mode)
 			case BlendEquation::ADD: return GL_FUNC_ADD;
 			case BlendEquation::SUB: return GL_FUNC_SUBTRACT;
 			case BlendEquation::RSUB: return GL_FUNC_REVERSE_SUBTRACT;
+			case BlendEquation::MAX: return GL_MAX;
 		}
 		bug_unreachable("invalid BlendEquation:%d", std::to_underlying(mode));
 	}();
@@ -18,6 +18,8 @@
 #include <imagine/gfx/RendererTask.hh>
 #include <imagine/base/ApplicationContext.hh>
 #include <imagine/base/Window.hh>
+#include <imagine/fs/FS.hh>
+#include <imagine/io/FileIO.hh>
 #include <imagine/util/ranges.hh>
 #include "internalDefs.hh"
 #include "utils.hh"
@@ -26,6 +28,7 @@
 #include <imagine/gfx/opengl/android/egl.hh>
 #endif
 #include <string>
+#include <vector>
 #include <cassert>
 #include <cctype>
 #include <format>
@@ -102,6 +105,10 @@ static void printFeatures(DrawContextSupport support)
 	{
 		featuresStr.append(" [PBOs]");
 	}
+	if(Config::Gfx::OPENGL_ES && support.hasBlendMinMax)
+	{
+		featuresStr.append(" [Blend Min/Max]");
+	}
 	if(!Config::Gfx::OPENGL_ES || (Config::Gfx::OPENGL_ES && support.glMapBufferRange))
 	{
 		featuresStr.append(" [Map Buffer Range]");
@@ -124,6 +131,10 @@ static void printFeatures(DrawContextSupport support)
 	{
 		featuresStr.append(" [sRGB FB Write Control]");
 	}
+	if(support.hasProgramBinary)
+	{
+		featuresStr.append(" [Program Binaries]");
+	}
 	if(!support.useFixedFunctionPipeline)
 	{
 		featuresStr.append(" [GLSL:");
@@ -316,6 +327,25 @@ void GLRenderer::setupMemoryBarrier()
 	#endif*/
 }
 
+void GLRenderer::setupProgramBinary(bool extSuffix)
+{
+	if(support.hasProgramBinary)
+		return;
+	// drivers can expose the API while supporting no formats, making the cache useless
+	GLint formats{};
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if(!formats)
+	{
+		logMsg("no program binary formats supported");
+		return;
+	}
+	support.hasProgramBinary = true;
+	#ifdef CONFIG_GFX_OPENGL_ES
+	support.glGetProgramBinary = (typeof(support.glGetProgramBinary))glManager.procAddress(extSuffix ? "glGetProgramBinaryOES" : "glGetProgramBinary");
+	support.glProgramBinary = (typeof(support.glProgramBinary))glManager.procAddress(extSuffix ? "glProgramBinaryOES" : "glProgramBinary");
+	#endif
+}
+
 void GLRenderer::checkExtensionString(std::string_view extStr, bool &useFBOFuncs)
 {
 	//logMsg("checking %s", extStr);
@@ -421,6 +451,14 @@ void GLRenderer::checkExtensionString(std::string_view extStr, bool &useFBOFuncs
 	{
 		support.hasSrgbWriteControl = true;
 	}
+	else if(Config::Gfx::OPENGL_ES >= 2 && extStr == "GL_EXT_blend_minmax")
+	{
+		support.hasBlendMinMax = true;
+	}
+	else if(Config::Gfx::OPENGL_ES >= 2 && extStr == "GL_OES_get_program_binary")
+	{
+		setupProgramBinary(true);
+	}
 	#endif
 	#ifndef CONFIG_GFX_OPENGL_ES
 	/*else if(string_equal(extStr, "GL_EXT_texture_filter_anisotropic"))
@@ -458,6 +496,10 @@ void GLRenderer::checkExtensionString(std::string_view extStr, bool &useFBOFuncs
 	{
 		setupPBO();
 	}
+	else if(extStr == "GL_ARB_get_program_binary")
+	{
+		setupProgramBinary(false);
+	}
 	else if(!Config::GL_PLATFORM_EGL && extStr == "GL_ARB_sync")
 	{
 		setupFenceSync();
@@ -499,19 +541,59 @@ static int glVersionFromStr(const char *versionStr)
 	return 10 * major + minor;
 }
 
+// Program binaries are only valid for the driver that made them, so the cache is cleared
+// when the GL renderer/version changes instead of leaving stale files behind forever
+static void prepareProgramBinaryCache(CStringView cachePath, std::string_view driverId)
+{
+	FS::create_directory(cachePath);
+	auto idPath = FS::pathString(cachePath, "driver.id");
+	if(auto idBuff = FileUtils::bufferFromPath(idPath, {.test = true});
+		idBuff && idBuff.stringView() == driverId)
+	{
+		return;
+	}
+	logMsg("clearing program binary cache for new driver:%s", std::string{driverId}.c_str());
+	try
+	{
+		std::vector<FS::PathString> paths;
+		for(auto &entry : FS::directory_iterator{cachePath})
+		{
+			paths.emplace_back(entry.path());
+		}
+		for(const auto &path : paths)
+		{
+			FS::remove(path);
+		}
+	}
+	catch(std::exception &err)
+	{
+		logErr("error clearing program binary cache:%s", err.what());
+	}
+	auto tempPath = FS::PathString{idPath}.append(".tmp");
+	if(FileUtils::writeToPath(tempPath, {(const uint8_t*)driverId.data(), driverId.size()}) == -1 ||
+		!FS::rename(tempPath, idPath))
+	{
+		logErr("error writing program binary cache driver id");
+		FS::remove(tempPath);
+	}
+}
+
 void Renderer::configureRenderer()
 {
 	if(Config::DEBUG_BUILD && defaultToFullErrorChecks)
 	{
 		setCorrectnessChecks(true);
 	}
+	programBinaryCachePath = FS::pathString(appContext().cachePath(), "shaderCache");
+	std::string driverId;
 	task().runSync(
-		[this](GLTask::TaskContext ctx)
+		[this, &driverId](GLTask::TaskContext ctx)
 		{
 			auto version = (const char*)glGetString(GL_VERSION);
 			assert(version);
 			auto rendererName = (const char*)glGetString(GL_RENDERER);
 			logMsg("version: %s (%s)", version, rendererName);
+			driverId = std::format("{}\n{}", rendererName ? rendererName : "", version);
 
 			int glVer = glVersionFromStr(version);
 
@@ -557,6 +639,10 @@ void Renderer::configureRenderer()
 			{
 				setupFenceSync();
 			}
+			if(glVer >= 41 && !support.useFixedFunctionPipeline)
+			{
+				setupProgramBinary(false);
+			}
 
 			// extension functionality
 			if(glVer >= 30)
@@ -612,7 +698,9 @@ void Renderer::configureRenderer()
 					if(!Config::envIsIOS)
 						setupSpecifyDrawReadBuffers();
 					support.hasUnpackRowLength = true;
+					support.hasBlendMinMax = true;
 					support.useLegacyGLSL = false;
+					setupProgramBinary(false);
 				}
 				if(glVer >= 31)
 				{
@@ -635,6 +723,8 @@ void Renderer::configureRenderer()
 			printFeatures(support);
 			task().runInitialCommandsInGL(ctx, support);
 		});
+	if(support.hasProgramBinary)
+		prepareProgramBinaryCache(programBinaryCachePath, driverId);
 	support.isConfigured = true;
 }
 
@@ -17,11 +17,15 @@
 #include <imagine/gfx/Program.hh>
 #include <imagine/gfx/Renderer.hh>
 #include <imagine/gfx/RendererTask.hh>
+#include <imagine/io/FileIO.hh>
+#include <imagine/fs/FS.hh>
+#include <imagine/time/Time.hh>
 #include <imagine/util/container/ArrayList.hh>
 #include "internalDefs.hh"
 #include "utils.hh"
 #include <cstring>
 #include <format>
+#include <memory>
 
 namespace IG::Gfx
 {
@@ -59,6 +63,156 @@ static bool linkGLProgram(GLuint program)
 	return true;
 }
 
+static bool compileGLShader(GLuint shader)
+{
+	glCompileShader(shader);
+	GLint success;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if(Config::DEBUG_BUILD)
+	{
+		GLchar messages[4096];
+		glGetShaderInfoLog(shader, sizeof(messages), nullptr, messages);
+		if(strlen(messages))
+			logDMsg("shader info log: %s", messages);
+	}
+	if(success == GL_FALSE)
+	{
+		if constexpr(Config::DEBUG_BUILD)
+		{
+			GLint srcLen{};
+			glGetShaderiv(shader, GL_SHADER_SOURCE_LENGTH, &srcLen);
+			std::string src(std::max(srcLen, 1), '\0');
+			glGetShaderSource(shader, src.size(), nullptr, src.data());
+			logErr("failed shader source:");
+			logger_printfn(LOG_E, "%s", src.c_str());
+		}
+		return false;
+	}
+	return true;
+}
+
+// Compiles a shader whose compilation was deferred, see makeGLShader()
+static bool compileGLShaderIfNeeded(GLuint shader)
+{
+	GLint compiled{};
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+	return compiled == GL_TRUE || compileGLShader(shader);
+}
+
+// Linked programs are cached in the app cache directory as driver program binaries,
+// keyed by the shader sources, program flags, and GL renderer/version strings.
+// A header mismatch or a binary the driver rejects is removed and falls back to a normal link,
+// the whole cache is cleared when the driver changes (see prepareProgramBinaryCache()).
+// With binaries available, shaders are only compiled once a program misses the cache.
+
+static constexpr uint32_t programBinaryMagic = 0x42504749; // "IGPB"
+
+struct ProgramBinaryHeader
+{
+	uint32_t magic;
+	uint32_t format;
+	uint64_t key;
+};
+
+static uint64_t fnv1aHash(uint64_t hash, std::string_view str)
+{
+	for(auto c : str)
+	{
+		hash ^= (uint8_t)c;
+		hash *= 0x100000001b3;
+	}
+	return hash;
+}
+
+static uint64_t glStringHash(uint64_t hash, GLenum name)
+{
+	auto str = (const char*)glGetString(name);
+	return fnv1aHash(hash, str ? str : "");
+}
+
+static uint64_t shaderSourceHash(uint64_t hash, GLuint shader)
+{
+	GLint srcLen{};
+	glGetShaderiv(shader, GL_SHADER_SOURCE_LENGTH, &srcLen);
+	if(srcLen <= 0)
+		return hash;
+	std::string src(srcLen, '\0');
+	GLsizei writtenLen{};
+	glGetShaderSource(shader, srcLen, &writtenLen, src.data());
+	// include a separator so sources split differently across shaders can't collide
+	return fnv1aHash(fnv1aHash(hash, {src.data(), (size_t)writtenLen}), {"\0", 1});
+}
+
+static uint64_t programBinaryKey(GLuint vShader, GLuint fShader, ProgramFlags flags)
+{
+	uint64_t hash = 0xcbf29ce484222325;
+	hash = glStringHash(hash, GL_RENDERER);
+	hash = glStringHash(hash, GL_VERSION);
+	hash = shaderSourceHash(hash, vShader);
+	hash = shaderSourceHash(hash, fShader);
+	char flagsChar = '0' + (flags.hasColor | (flags.hasTexture << 1));
+	return fnv1aHash(hash, {&flagsChar, 1});
+}
+
+static bool loadProgramBinary(const DrawContextSupport &support, GLuint program, CStringView path, uint64_t key)
+{
+	auto buff = FileUtils::bufferFromPath(path, {.test = true});
+	if(buff.size() <= sizeof(ProgramBinaryHeader))
+		return false;
+	ProgramBinaryHeader header;
+	memcpy(&header, buff.data(), sizeof(header));
+	if(header.magic != programBinaryMagic || header.key != key)
+	{
+		logMsg("removing mismatched program binary:%s", path.data());
+		FS::remove(path);
+		return false;
+	}
+	runGLChecked(
+		[&]()
+		{
+			support.glProgramBinary(program, header.format, buff.data() + sizeof(header), buff.size() - sizeof(header));
+		}, "glProgramBinary()");
+	GLint success{};
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if(success == GL_FALSE)
+	{
+		logMsg("removing program binary rejected by driver:%s", path.data());
+		FS::remove(path);
+		return false;
+	}
+	return true;
+}
+
+static void saveProgramBinary(const DrawContextSupport &support, GLuint program, CStringView path, uint64_t key)
+{
+	GLint binarySize{};
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+	if(binarySize <= 0)
+		return;
+	constexpr auto headerSize = sizeof(ProgramBinaryHeader);
+	auto buff = std::make_unique<uint8_t[]>(headerSize + binarySize);
+	GLsizei writtenSize{};
+	GLenum format{};
+	runGLChecked(
+		[&]()
+		{
+			support.glGetProgramBinary(program, binarySize, &writtenSize, &format, buff.get() + headerSize);
+		}, "glGetProgramBinary()");
+	if(writtenSize <= 0)
+		return;
+	ProgramBinaryHeader header{programBinaryMagic, format, key};
+	memcpy(buff.get(), &header, headerSize);
+	// write to a temporary file first so an interrupted write never leaves a truncated binary
+	auto tempPath = FS::PathString{path}.append(".tmp");
+	if(FileUtils::writeToPath(tempPath, {buff.get(), headerSize + writtenSize}) == -1 || !FS::rename(tempPath, path))
+	{
+		logErr("error writing program binary:%s", path.data());
+		FS::remove(tempPath);
+		return;
+	}
+	logMsg("wrote program binary:%s (%d bytes)", path.data(), writtenSize);
+}
+
 void destroyGLShader(RendererTask &rTask, NativeShader s)
 {
 	if(!s)
@@ -96,43 +250,75 @@ void destroyGLProgram(RendererTask &rTask, NativeProgram p)
 		});
 }
 
+static bool linkProgramFromShaders([[maybe_unused]] const DrawContextSupport &support, GLuint program, ProgramFlags flags)
+{
+	runGLChecked(
+		[&]()
+		{
+			glBindAttribLocation(program, VATTR_POS, "pos");
+		}, "glBindAttribLocation(..., pos)");
+	if(flags.hasColor)
+	{
+		runGLChecked(
+			[&]()
+			{
+				glBindAttribLocation(program, VATTR_COLOR, "color");
+			}, "glBindAttribLocation(..., color)");
+	}
+	if(flags.hasTexture)
+	{
+		runGLChecked(
+			[&]()
+			{
+				glBindAttribLocation(program, VATTR_TEX_UV, "texUV");
+			}, "glBindAttribLocation(..., texUV)");
+	}
+	#ifndef CONFIG_GFX_OPENGL_ES
+	if(support.hasProgramBinary)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	#endif
+	return linkGLProgram(program);
+}
+
 Program::Program(RendererTask &rTask, NativeShader vShader, NativeShader fShader,
 	ProgramFlags flags, std::span<UniformLocationDesc> uniformDescs)
 {
 	GLuint programOut{};
+	auto &r = rTask.renderer();
 	rTask.runSync(
-		[=, &programOut]()
+		[=, &programOut, &support = r.support, &cachePath = r.programBinaryCachePath]()
 		{
+			auto startTime = SteadyClock::now();
 			auto program = makeGLProgram(vShader, fShader);
 			if(!program) [[unlikely]]
 				return;
-			runGLChecked(
-				[&]()
-				{
-					glBindAttribLocation(program, VATTR_POS, "pos");
-				}, "glBindAttribLocation(..., pos)");
-			if(flags.hasColor)
+			uint64_t binaryKey{};
+			FS::PathString binaryPath;
+			bool loadedBinary{};
+			if(support.hasProgramBinary)
 			{
-				runGLChecked(
-					[&]()
-					{
-						glBindAttribLocation(program, VATTR_COLOR, "color");
-					}, "glBindAttribLocation(..., color)");
+				binaryKey = programBinaryKey(vShader, fShader, flags);
+				binaryPath = FS::pathString(cachePath, std::format("{:016x}.bin", binaryKey));
+				loadedBinary = loadProgramBinary(support, program, binaryPath, binaryKey);
 			}
-			if(flags.hasTexture)
+			if(loadedBinary)
 			{
-				runGLChecked(
-					[&]()
-					{
-						glBindAttribLocation(program, VATTR_TEX_UV, "texUV");
-					}, "glBindAttribLocation(..., texUV)");
+				logMsg("loaded program:%d from binary in %lldus", program,
+					(long long)duration_cast<Microseconds>(SteadyClock::now() - startTime).count());
 			}
-			if(!linkGLProgram(program))
+			else
 			{
-				glDeleteProgram(program);
-				return;
+				if(!compileGLShaderIfNeeded(vShader) || !compileGLShaderIfNeeded(fShader) ||
+					!linkProgramFromShaders(support, program, flags))
+				{
+					glDeleteProgram(program);
+					return;
+				}
+				logMsg("made program:%d in %lldus", program,
+					(long long)duration_cast<Microseconds>(SteadyClock::now() - startTime).count());
+				if(support.hasProgramBinary)
+					saveProgramBinary(support, program, binaryPath, binaryKey);
 			}
-			logMsg("made program:%d", program);
 			glDetachShader(program, vShader);
 			glDetachShader(program, fShader);
 			for(auto desc : uniformDescs)
@@ -261,8 +447,10 @@ static GLuint makeGLShader(RendererTask &rTask, std::span<std::string_view> srcs
 		return 0;
 	}
 	GLuint shaderOut{};
+	// compiling is deferred to program creation when a cached program binary may make it unneeded
+	bool deferCompile = rTask.renderer().support.hasProgramBinary;
 	rTask.runSync(
-		[&shaderOut, srcs, type]()
+		[&shaderOut, srcs, type, deferCompile]()
 		{
 			auto shader = glCreateShader((GLenum)type);
 			StaticArrayList<const GLchar*, maxSourceStrings> srcStrings;
@@ -273,32 +461,12 @@ static GLuint makeGLShader(RendererTask &rTask, std::span<std::string_view> srcs
 				srcSizes.emplace_back(s.size());
 			}
 			glShaderSource(shader, srcs.size(), srcStrings.data(), srcSizes.data());
-			glCompileShader(shader);
-			GLint success;
-			glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-			if(Config::DEBUG_BUILD)
+			if(!deferCompile && !compileGLShader(shader))
 			{
-				GLchar messages[4096];
-				glGetShaderInfoLog(shader, sizeof(messages), nullptr, messages);
-				if(strlen(messages))
-					logDMsg("shader info log: %s", messages);
-			}
-			if(success == GL_FALSE)
-			{
-				if constexpr(Config::DEBUG_BUILD)
-				{
-					logErr("failed shader source:");
-					for(auto &s : srcs)
-					{
-						logger_printfn(LOG_E, "[part %zu]", (size_t)std::distance(srcs.data(), &s));
-						logger_printfn(LOG_E, "%s", std::format("{}", s).c_str());
-					}
-				}
-			}
-			else
-			{
-				shaderOut = shader;
+				glDeleteShader(shader);
+				return;
 			}
+			shaderOut = shader;
 		});
 	if(shaderOut)
 		logMsg("made %s shader:%d", type == ShaderType::FRAGMENT ? "fragment" : "vertex", shaderOut);